@@ -0,0 +1,34 @@
+//
+//  MASChurn+Private.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASChurn.h"
+
+/**
+ *	Counts an event for a view and globally. Must be called on the main thread like all installs
+ */
+void MASChurnRecordEvent(MAS_VIEW *view, MASChurnEvent event);
+
+/**
+ *	Counts a layout constraint removed from a view and remembers its structure for a while
+ */
+void MASChurnRecordUninstall(MAS_VIEW *view, NSUInteger structureHash);
+
+/**
+ *	Counts a new layout constraint of a view, as reinstalled if the view recently lost one with the same structure
+ */
+void MASChurnRecordInstall(MAS_VIEW *view, NSUInteger structureHash);
+
+/**
+ *	Number of times an event happened to a view, without allocating anything for views Masonry never touched
+ */
+NSUInteger MASChurnCountForView(MAS_VIEW *view, MASChurnEvent event);
+
+/**
+ *	Notes a make or remake pass over a view that reproduced constraints it already had, reporting the view once it thrashes
+ */
+void MASChurnRecordRepeatedPass(MAS_VIEW *view);
@@ -0,0 +1,93 @@
+//
+//  MASChurn.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+
+/**
+ *  What happened to a layout constraint installed by Masonry
+ */
+typedef NS_ENUM(NSUInteger, MASChurnEvent) {
+    /** a new layout constraint was added to the layout engine */
+    MASChurnEventCreated,
+    /** an existing layout constraint was reused by mas_updateConstraints: or mas_remakeConstraints:, at most changing its constant */
+    MASChurnEventUpdatedInPlace,
+    /** a new layout constraint was added with the same structure as one recently removed from the same view */
+    MASChurnEventReinstalled,
+    /** a layout constraint was removed from the layout engine */
+    MASChurnEventUninstalled,
+    /** a deactivated layout constraint was activated again by install */
+    MASChurnEventReactivated,
+    MASChurnEventCount,
+};
+
+/**
+ *  Number of times each MASChurnEvent happened
+ */
+typedef struct {
+    NSUInteger counts[MASChurnEventCount];
+} MASChurnCounts;
+
+/**
+ *  Always-on counters of how often Masonry creates, updates and removes layout constraints,
+ *  globally, per view and per mas_key, and detection of views whose constraints thrash.
+ *
+ *  A view thrashes when it repeatedly remakes or reinstalls constraints of the same structure,
+ *  typically because mas_remakeConstraints: is called from layoutSubviews or a cell configuration method.
+ *  More than thrashThreshold such passes within thrashWindow seconds call the thrashHandler once per window.
+ */
+@interface MASChurn : NSObject
+
+/**
+ *	Counts of all views since launch or the last resetGlobalCounts. May be read from any thread
+ */
++ (MASChurnCounts)globalCounts;
+
++ (void)resetGlobalCounts;
+
+/**
+ *	Counts of a single view since it was first constrained
+ */
++ (MASChurnCounts)countsForView:(MAS_VIEW *)view;
+
+/**
+ *	Counts of all views with an equal mas_key, counted while the key was set
+ */
++ (MASChurnCounts)countsForKey:(id<NSCopying>)key;
+
+/**
+ *	The number of distinct keys counted before all counts per key are reset, 1024 by default.
+ *  Keeps apps giving each view a unique mas_key from growing the counts without bound
+ */
++ (NSUInteger)maximumKeyCount;
++ (void)setMaximumKeyCount:(NSUInteger)maximumKeyCount;
+
+/**
+ *	The duration in seconds repeated passes are counted over, 1 by default
+ */
++ (NSTimeInterval)thrashWindow;
++ (void)setThrashWindow:(NSTimeInterval)thrashWindow;
+
+/**
+ *	The number of repeated passes within thrashWindow that counts as thrashing, 10 by default
+ */
++ (NSUInteger)thrashThreshold;
++ (void)setThrashThreshold:(NSUInteger)thrashThreshold;
+
+/**
+ *	Called on the main thread with a thrashing view and its mas_key.
+ *  Debug builds log thrashing views while no handler is set
+ */
++ (void (^)(MAS_VIEW *view, id key))thrashHandler;
++ (void)setThrashHandler:(void (^)(MAS_VIEW *view, id key))thrashHandler;
+
+/**
+ *	Number of times any view was detected thrashing
+ */
++ (NSUInteger)thrashCount;
+
+@end
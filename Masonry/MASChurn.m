@@ -0,0 +1,170 @@
+//
+//  MASChurn.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASChurn+Private.h"
+#import "MASViewRecord.h"
+#import "View+MASAdditions.h"
+#import <stdatomic.h>
+
+static _Atomic NSUInteger MASChurnGlobalCounts[MASChurnEventCount];
+static _Atomic NSUInteger MASChurnThrashCount;
+
+// main thread only
+static NSMutableDictionary *MASChurnCountsByKey;
+static NSUInteger MASChurnMaximumKeyCount = 1024;
+static NSTimeInterval MASChurnThrashWindow = 1;
+static NSUInteger MASChurnThrashThreshold = 10;
+static void (^MASChurnThrashHandler)(MAS_VIEW *view, id key);
+
+void MASChurnRecordEvent(MAS_VIEW *view, MASChurnEvent event) {
+    atomic_fetch_add_explicit(&MASChurnGlobalCounts[event], 1, memory_order_relaxed);
+
+    MASViewRecord *record = [MASViewRecord recordForItem:view];
+    if (!record) return;
+    record->_churnCounts.counts[event]++;
+
+    id key = record.key;
+    if (!key || ![key conformsToProtocol:@protocol(NSCopying)]) return;
+    if (!MASChurnCountsByKey) {
+        MASChurnCountsByKey = [NSMutableDictionary dictionary];
+    }
+    NSMutableData *counts = MASChurnCountsByKey[key];
+    if (!counts) {
+        if (MASChurnCountsByKey.count >= MASChurnMaximumKeyCount) {
+            // a unique key per view would grow the table without bound, start over instead of keeping stale keys
+            [MASChurnCountsByKey removeAllObjects];
+        }
+        counts = [NSMutableData dataWithLength:sizeof(MASChurnCounts)];
+        MASChurnCountsByKey[key] = counts;
+    }
+    ((MASChurnCounts *)counts.mutableBytes)->counts[event]++;
+}
+
+void MASChurnRecordUninstall(MAS_VIEW *view, NSUInteger structureHash) {
+    MASChurnRecordEvent(view, MASChurnEventUninstalled);
+
+    MASViewRecord *record = [MASViewRecord existingRecordForItem:view];
+    if (!record) return;
+    NSUInteger index = record->_nextRecentlyUninstalledIndex++ % MAS_VIEW_RECORD_RECENT_UNINSTALL_COUNT;
+    record->_recentlyUninstalledStructures[index] = structureHash ?: 1;
+    record->_recentlyUninstalledTimes[index] = CFAbsoluteTimeGetCurrent();
+}
+
+void MASChurnRecordInstall(MAS_VIEW *view, NSUInteger structureHash) {
+    MASViewRecord *record = [MASViewRecord recordForItem:view];
+    if (!record) return;
+    structureHash = structureHash ?: 1;
+    CFAbsoluteTime now = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < MAS_VIEW_RECORD_RECENT_UNINSTALL_COUNT; i++) {
+        if (record->_recentlyUninstalledStructures[i] != structureHash) continue;
+        if (now - record->_recentlyUninstalledTimes[i] > MASChurnThrashWindow) continue;
+
+        // each removal pairs with one reinstall
+        record->_recentlyUninstalledStructures[i] = 0;
+        MASChurnRecordEvent(view, MASChurnEventReinstalled);
+        return;
+    }
+    MASChurnRecordEvent(view, MASChurnEventCreated);
+}
+
+NSUInteger MASChurnCountForView(MAS_VIEW *view, MASChurnEvent event) {
+    MASViewRecord *record = [MASViewRecord existingRecordForItem:view];
+    return record ? record->_churnCounts.counts[event] : 0;
+}
+
+void MASChurnRecordRepeatedPass(MAS_VIEW *view) {
+    MASViewRecord *record = [MASViewRecord recordForItem:view];
+    if (!record) return;
+    CFAbsoluteTime now = CFAbsoluteTimeGetCurrent();
+    if (now - record->_thrashWindowStart > MASChurnThrashWindow) {
+        record->_thrashWindowStart = now;
+        record->_thrashWindowPasses = 0;
+    }
+    // report once per window
+    if (++record->_thrashWindowPasses != MASChurnThrashThreshold + 1) return;
+
+    atomic_fetch_add_explicit(&MASChurnThrashCount, 1, memory_order_relaxed);
+    if (MASChurnThrashHandler) {
+        MASChurnThrashHandler(view, record.key);
+        return;
+    }
+#ifdef DEBUG
+    NSLog(@"Masonry: %@ (mas_key %@) remade or reinstalled the same constraints %lu times within %gs, "
+          @"check for mas_remakeConstraints: calls from layoutSubviews or cell configuration",
+          view, record.key, (unsigned long)record->_thrashWindowPasses, MASChurnThrashWindow);
+#endif
+}
+
+@implementation MASChurn
+
++ (MASChurnCounts)globalCounts {
+    MASChurnCounts counts;
+    for (NSUInteger i = 0; i < MASChurnEventCount; i++) {
+        counts.counts[i] = atomic_load_explicit(&MASChurnGlobalCounts[i], memory_order_relaxed);
+    }
+    return counts;
+}
+
++ (void)resetGlobalCounts {
+    for (NSUInteger i = 0; i < MASChurnEventCount; i++) {
+        atomic_store_explicit(&MASChurnGlobalCounts[i], 0, memory_order_relaxed);
+    }
+}
+
++ (MASChurnCounts)countsForView:(MAS_VIEW *)view {
+    MASViewRecord *record = [MASViewRecord existingRecordForItem:view];
+    MASChurnCounts counts = { { 0 } };
+    return record ? record->_churnCounts : counts;
+}
+
++ (MASChurnCounts)countsForKey:(id<NSCopying>)key {
+    MASChurnCounts counts = { { 0 } };
+    NSData *data = key ? MASChurnCountsByKey[key] : nil;
+    if (data) {
+        memcpy(&counts, data.bytes, sizeof(MASChurnCounts));
+    }
+    return counts;
+}
+
++ (NSUInteger)maximumKeyCount {
+    return MASChurnMaximumKeyCount;
+}
+
++ (void)setMaximumKeyCount:(NSUInteger)maximumKeyCount {
+    MASChurnMaximumKeyCount = maximumKeyCount;
+}
+
++ (NSTimeInterval)thrashWindow {
+    return MASChurnThrashWindow;
+}
+
++ (void)setThrashWindow:(NSTimeInterval)thrashWindow {
+    MASChurnThrashWindow = thrashWindow;
+}
+
++ (NSUInteger)thrashThreshold {
+    return MASChurnThrashThreshold;
+}
+
++ (void)setThrashThreshold:(NSUInteger)thrashThreshold {
+    MASChurnThrashThreshold = thrashThreshold;
+}
+
++ (void (^)(MAS_VIEW *, id))thrashHandler {
+    return MASChurnThrashHandler;
+}
+
++ (void)setThrashHandler:(void (^)(MAS_VIEW *, id))thrashHandler {
+    MASChurnThrashHandler = [thrashHandler copy];
+}
+
++ (NSUInteger)thrashCount {
+    return atomic_load_explicit(&MASChurnThrashCount, memory_order_relaxed);
+}
+
+@end
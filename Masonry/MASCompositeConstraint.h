@@ -23,4 +23,16 @@
  */
 - (id)initWithChildren:(NSArray *)children;
 
+/**
+ *	Creates a composite of new MASViewConstraints, one for each attribute of the view.
+ *  Used for edges, size, center and attributes without staging the children in an array first
+ *
+ *	@param	view	the first item of every child
+ *	@param	layoutAttributes	the first attribute of each child, in order
+ *	@param	count	the number of attributes
+ *
+ *	@return	a composite constraint
+ */
+- (id)initWithView:(MAS_VIEW *)view layoutAttributes:(const NSLayoutAttribute *)layoutAttributes count:(NSUInteger)count;
+
 @end
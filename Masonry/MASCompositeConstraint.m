@@ -8,6 +8,7 @@
 
 #import "MASCompositeConstraint.h"
 #import "MASConstraint+Private.h"
+#import "MASViewConstraint.h"
 
 @interface MASCompositeConstraint () <MASConstraintDelegate>
 
@@ -22,27 +23,53 @@
     self = [super init];
     if (!self) return nil;
 
-    _childConstraints = [children mutableCopy];
-    for (MASConstraint *constraint in _childConstraints) {
-        constraint.delegate = self;
+    _childConstraints = [NSMutableArray arrayWithCapacity:children.count];
+    for (MASConstraint *constraint in children) {
+        if ([constraint isKindOfClass:MASCompositeConstraint.class]) {
+            // grouping composites adopts their children, so modifiers never go through more than one level
+            for (MASConstraint *childConstraint in ((MASCompositeConstraint *)constraint).childConstraints) {
+                [self addChildConstraint:childConstraint];
+            }
+        } else {
+            [self addChildConstraint:constraint];
+        }
+    }
+
+    return self;
+}
+
+- (id)initWithView:(MAS_VIEW *)view layoutAttributes:(const NSLayoutAttribute *)layoutAttributes count:(NSUInteger)count {
+    self = [super init];
+    if (!self) return nil;
+
+    _childConstraints = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        MASViewAttribute *viewAttribute = [MASViewAttribute attributeWithView:view layoutAttribute:layoutAttributes[i]];
+        [self addChildConstraint:[[MASViewConstraint alloc] initWithFirstViewAttribute:viewAttribute]];
     }
 
     return self;
 }
 
+- (void)addChildConstraint:(MASConstraint *)constraint {
+    constraint.delegate = self;
+    constraint.delegateIndex = self.childConstraints.count;
+    [self.childConstraints addObject:constraint];
+}
+
 #pragma mark - MASConstraintDelegate
 
 - (void)constraint:(MASConstraint *)constraint shouldBeReplacedWithConstraint:(MASConstraint *)replacementConstraint {
-    NSUInteger index = [self.childConstraints indexOfObject:constraint];
-    NSAssert(index != NSNotFound, @"Could not find constraint %@", constraint);
+    NSUInteger index = constraint.delegateIndex;
+    NSAssert(index < self.childConstraints.count && self.childConstraints[index] == constraint, @"Could not find constraint %@", constraint);
+    replacementConstraint.delegateIndex = index;
     [self.childConstraints replaceObjectAtIndex:index withObject:replacementConstraint];
 }
 
 - (MASConstraint *)constraint:(MASConstraint __unused *)constraint addConstraintWithLayoutAttribute:(NSLayoutAttribute)layoutAttribute {
     id<MASConstraintDelegate> strongDelegate = self.delegate;
     MASConstraint *newConstraint = [strongDelegate constraint:self addConstraintWithLayoutAttribute:layoutAttribute];
-    newConstraint.delegate = self;
-    [self.childConstraints addObject:newConstraint];
+    [self addChildConstraint:newConstraint];
     return newConstraint;
 }
 
@@ -50,38 +77,47 @@
 
 - (MASConstraint * (^)(CGFloat))multipliedBy {
     return ^id(CGFloat multiplier) {
-        for (MASConstraint *constraint in self.childConstraints) {
-            constraint.multipliedBy(multiplier);
-        }
+        [self applyMultiplier:multiplier];
         return self;
     };
 }
 
 - (MASConstraint * (^)(CGFloat))dividedBy {
     return ^id(CGFloat divider) {
-        for (MASConstraint *constraint in self.childConstraints) {
-            constraint.dividedBy(divider);
-        }
+        [self applyMultiplier:1.0/divider];
         return self;
     };
 }
 
+- (void)applyMultiplier:(CGFloat)multiplier {
+    for (MASConstraint *constraint in self.childConstraints) {
+        [constraint applyMultiplier:multiplier];
+    }
+}
+
 #pragma mark - MASLayoutPriority proxy
 
 - (MASConstraint * (^)(MASLayoutPriority))priority {
     return ^id(MASLayoutPriority priority) {
-        for (MASConstraint *constraint in self.childConstraints) {
-            constraint.priority(priority);
-        }
+        [self applyPriority:priority];
         return self;
     };
 }
 
+- (void)applyPriority:(MASLayoutPriority)priority {
+    for (MASConstraint *constraint in self.childConstraints) {
+        [constraint applyPriority:priority];
+    }
+}
+
 #pragma mark - NSLayoutRelation proxy
 
 - (MASConstraint * (^)(id, NSLayoutRelation))equalToWithRelation {
     return ^id(id attr, NSLayoutRelation relation) {
-        for (MASConstraint *constraint in self.childConstraints.copy) {
+        // children spawning a composite for an array replace themselves at the same index
+        NSMutableArray *childConstraints = self.childConstraints;
+        for (NSUInteger i = 0; i < childConstraints.count; i++) {
+            MASConstraint *constraint = childConstraints[i];
             constraint.equalToWithRelation(attr, relation);
         }
         return self;
@@ -112,15 +148,19 @@
 
 - (MASConstraint * (^)(id))key {
     return ^id(id key) {
-        self.mas_key = key;
-        int i = 0;
-        for (MASConstraint *constraint in self.childConstraints) {
-            constraint.key([NSString stringWithFormat:@"%@[%d]", key, i++]);
-        }
+        [self applyKey:key];
         return self;
     };
 }
 
+- (void)applyKey:(id)key {
+    self.mas_key = key;
+    int i = 0;
+    for (MASConstraint *constraint in self.childConstraints) {
+        [constraint applyKey:[NSString stringWithFormat:@"%@[%d]", key, i++]];
+    }
+}
+
 #pragma mark - NSLayoutConstraint constant setters
 
 - (void)setInsets:(MASEdgeInsets)insets {
@@ -180,4 +220,10 @@
     }
 }
 
+- (void)addViewConstraintsToArray:(NSMutableArray *)viewConstraints {
+    for (MASConstraint *constraint in self.childConstraints) {
+        [constraint addViewConstraintsToArray:viewConstraints];
+    }
+}
+
 @end
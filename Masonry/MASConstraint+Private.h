@@ -23,6 +23,11 @@
  */
 @property (nonatomic, weak) id<MASConstraintDelegate> delegate;
 
+/**
+ *	The position of the constraint among the constraints of its delegate, lets the delegate replace it without searching
+ */
+@property (nonatomic, assign) NSUInteger delegateIndex;
+
 /**
  *  Based on a provided value type, is equal to calling:
  *  NSNumber - setOffset:
@@ -50,6 +55,19 @@
  */
 - (MASConstraint *)addConstraintWithLayoutAttribute:(NSLayoutAttribute)layoutAttribute;
 
+/**
+ *	Appends the MASViewConstraints making up this constraint, flattening any composites
+ */
+- (void)addViewConstraintsToArray:(NSMutableArray *)viewConstraints;
+
+/**
+ *	The modifiers behind multipliedBy, dividedBy, priority and key,
+ *  so composites can apply them to their children without a block per child
+ */
+- (void)applyMultiplier:(CGFloat)multiplier;
+- (void)applyPriority:(MASLayoutPriority)priority;
+- (void)applyKey:(id)key;
+
 @end
 
 
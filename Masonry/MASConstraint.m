@@ -294,4 +294,12 @@
 
 - (void)uninstall { MASMethodNotImplemented(); }
 
+- (void)addViewConstraintsToArray:(NSMutableArray __unused *)viewConstraints { MASMethodNotImplemented(); }
+
+- (void)applyMultiplier:(CGFloat __unused)multiplier { MASMethodNotImplemented(); }
+
+- (void)applyPriority:(MASLayoutPriority __unused)priority { MASMethodNotImplemented(); }
+
+- (void)applyKey:(id __unused)key { MASMethodNotImplemented(); }
+
 @end
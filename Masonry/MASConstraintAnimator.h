@@ -0,0 +1,84 @@
+//
+//  MASConstraintAnimator.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+
+@class MASConstraint;
+
+/**
+ *  How an animation progresses between its from and to constants
+ */
+typedef NS_ENUM(NSUInteger, MASAnimationCurve) {
+    MASAnimationCurveLinear,
+    MASAnimationCurveEaseIn,
+    MASAnimationCurveEaseOut,
+    MASAnimationCurveEaseInOut,
+};
+
+/**
+ *  Animates the constants of many Masonry constraints from one tick per frame.
+ *
+ *  Animations are kept in a table with one column per field, so each tick interpolates every animation in a single loop,
+ *  writes only the constants that changed since the previous tick and then lays out once,
+ *  at the closest common superview of the views the animated constraints are installed on.
+ *  Animating a constraint that is already animating retargets it from its current constant.
+ *
+ *  Animators created with init are timed by CACurrentMediaTime and tick on every display refresh while they have animations.
+ *  Animators created with a custom clock never tick on their own, call tick to advance them, eg from tests and benchmarks.
+ *  Must be used on the main thread.
+ */
+@interface MASConstraintAnimator : NSObject
+
+/**
+ *	Creates an animator which times its animations with a custom clock and only advances when tick is called
+ *
+ *	@param	clock	returns the current time in seconds
+ */
+- (id)initWithClock:(CFTimeInterval (^)(void))clock;
+
+/**
+ *	Animates the constant of a constraint, or of every child of a composite, starting at the current time of the clock
+ *
+ *	@param	constraint	an installed MASConstraint
+ *	@param	constant	the constant at the end of the animation
+ *	@param	duration	the length of the animation in seconds, 0 sets the constant on the next tick
+ *	@param	curve	how the animation progresses
+ */
+- (void)animateConstraint:(MASConstraint *)constraint toConstant:(CGFloat)constant
+                 duration:(NSTimeInterval)duration curve:(MASAnimationCurve)curve;
+
+/**
+ *	Stops animating a constraint, leaving its constant where the last tick put it
+ */
+- (void)stopAnimatingConstraint:(MASConstraint *)constraint;
+
+/**
+ *	Stops every animation, leaving the constants where the last tick put them
+ */
+- (void)stopAllAnimations;
+
+/**
+ *	The number of constraints currently animating
+ */
+@property (nonatomic, assign, readonly) NSUInteger animationCount;
+
+/**
+ *	Called after the tick that finishes the last running animation
+ */
+@property (nonatomic, copy) void (^completion)(void);
+
+/**
+ *	Interpolates every animation at the current time of the clock, writes the constants that changed
+ *  and lays out the closest common superview of their installed views once.
+ *  Finished animations are removed after writing their final constant
+ *
+ *	@return	the number of constants written
+ */
+- (NSUInteger)tick;
+
+@end
@@ -0,0 +1,316 @@
+//
+//  MASConstraintAnimator.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASConstraintAnimator.h"
+#import "MASConstraint+Private.h"
+#import "MASViewConstraint+Private.h"
+#import "View+MASAdditions.h"
+#import "MASTrace+Private.h"
+#import <QuartzCore/QuartzCore.h>
+
+// display links and timers retain their target, the run loop only gets a weak path to the animator
+@interface MASConstraintAnimatorTicker : NSObject
+
+@property (nonatomic, weak) MASConstraintAnimator *animator;
+
+@end
+
+@implementation MASConstraintAnimatorTicker
+
+- (void)tick:(id __unused)sender {
+    [self.animator tick];
+}
+
+@end
+
+// only replaces the column once realloc succeeded, the old one stays valid otherwise
+static BOOL MASConstraintAnimatorGrowColumn(void **column, NSUInteger capacity, size_t size) {
+    void *grown = realloc(*column, capacity * size);
+    if (!grown) return NO;
+    *column = grown;
+    return YES;
+}
+
+static CGFloat MASAnimationCurveProgress(MASAnimationCurve curve, CGFloat t) {
+    switch (curve) {
+        case MASAnimationCurveEaseIn:
+            return t * t;
+        case MASAnimationCurveEaseOut:
+            return t * (2 - t);
+        case MASAnimationCurveEaseInOut:
+            return t < 0.5 ? 2 * t * t : -1 + (4 - 2 * t) * t;
+        case MASAnimationCurveLinear:
+        default:
+            return t;
+    }
+}
+
+@implementation MASConstraintAnimator {
+    CFTimeInterval (^_clock)(void);
+    BOOL _ticksWithDisplay;
+    id _displayLink;
+
+    // one row per animating MASViewConstraint, a removed row is filled with the last one
+    NSUInteger _count;
+    NSUInteger _capacity;
+    CFTypeRef *_constraints;
+    CGFloat *_fromConstants;
+    CGFloat *_toConstants;
+    CGFloat *_writtenConstants;
+    CFTimeInterval *_startTimes;
+    CFTimeInterval *_durations;
+    MASAnimationCurve *_curves;
+
+    // the closest common superview of the installed views, recomputed when rows are added or removed
+    __weak MAS_VIEW *_layoutRoot;
+    BOOL _layoutRootNeedsUpdate;
+}
+
+- (id)init {
+    self = [self initWithClock:^CFTimeInterval{
+        return CACurrentMediaTime();
+    }];
+    if (!self) return nil;
+
+    _ticksWithDisplay = YES;
+
+    return self;
+}
+
+- (id)initWithClock:(CFTimeInterval (^)(void))clock {
+    NSParameterAssert(clock);
+    self = [super init];
+    if (!self) return nil;
+
+    _clock = [clock copy];
+
+    return self;
+}
+
+- (void)dealloc {
+    [_displayLink invalidate];
+    for (NSUInteger i = 0; i < _count; i++) {
+        CFRelease(_constraints[i]);
+    }
+    free(_constraints);
+    free(_fromConstants);
+    free(_toConstants);
+    free(_writtenConstants);
+    free(_startTimes);
+    free(_durations);
+    free(_curves);
+}
+
+#pragma mark - Animations
+
+- (NSUInteger)animationCount {
+    return _count;
+}
+
+- (void)animateConstraint:(MASConstraint *)constraint toConstant:(CGFloat)constant
+                 duration:(NSTimeInterval)duration curve:(MASAnimationCurve)curve {
+    NSMutableArray *viewConstraints = [NSMutableArray array];
+    [constraint addViewConstraintsToArray:viewConstraints];
+    CFTimeInterval now = _clock();
+
+    for (MASViewConstraint *viewConstraint in viewConstraints) {
+        NSUInteger row = [self rowOfConstraint:viewConstraint];
+        if (row == NSNotFound) {
+            row = [self addRowForConstraint:viewConstraint];
+            // out of memory, the constraint keeps its constant
+            if (row == NSNotFound) continue;
+            _writtenConstants[row] = viewConstraint.layoutConstant;
+        }
+        // retargeting starts from wherever the last tick left the constant
+        _fromConstants[row] = _writtenConstants[row];
+        _toConstants[row] = constant;
+        _startTimes[row] = now;
+        _durations[row] = MAX(duration, 0);
+        _curves[row] = curve;
+    }
+    [self updateDisplayLink];
+}
+
+- (void)stopAnimatingConstraint:(MASConstraint *)constraint {
+    NSMutableArray *viewConstraints = [NSMutableArray array];
+    [constraint addViewConstraintsToArray:viewConstraints];
+    for (MASViewConstraint *viewConstraint in viewConstraints) {
+        NSUInteger row = [self rowOfConstraint:viewConstraint];
+        if (row != NSNotFound) {
+            [self removeRow:row];
+        }
+    }
+    [self updateDisplayLink];
+}
+
+- (void)stopAllAnimations {
+    for (NSUInteger i = 0; i < _count; i++) {
+        CFRelease(_constraints[i]);
+    }
+    _count = 0;
+    _layoutRootNeedsUpdate = YES;
+    [self updateDisplayLink];
+}
+
+- (NSUInteger)tick {
+    if (!_count) return 0;
+
+    MAS_TRACE_BEGIN(span, "MASConstraintAnimator tick");
+    CFTimeInterval now = _clock();
+    NSUInteger writtenCount = 0;
+    BOOL finished = NO;
+    for (NSUInteger i = 0; i < _count; i++) {
+        CFTimeInterval duration = _durations[i];
+        CGFloat progress = duration > 0 ? (CGFloat)MIN(MAX((now - _startTimes[i]) / duration, 0), 1) : 1;
+        CGFloat constant = _toConstants[i];
+        if (progress < 1) {
+            constant = _fromConstants[i] + (constant - _fromConstants[i]) * MASAnimationCurveProgress(_curves[i], progress);
+        } else {
+            finished = YES;
+        }
+        if (constant == _writtenConstants[i]) continue;
+
+        _writtenConstants[i] = constant;
+        ((__bridge MASViewConstraint *)_constraints[i]).layoutConstant = constant;
+        writtenCount++;
+    }
+
+    if (writtenCount) {
+        [self layoutIfNeeded];
+    }
+    if (finished) {
+        // walking backwards, the row moved into a removed one has already been checked
+        for (NSUInteger i = _count; i > 0; i--) {
+            if (_durations[i - 1] <= 0 || now - _startTimes[i - 1] >= _durations[i - 1]) {
+                [self removeRow:i - 1];
+            }
+        }
+    }
+    MAS_TRACE_END(span, nil, writtenCount, MASTraceModeUpdate);
+
+    if (finished && !_count) {
+        [self updateDisplayLink];
+        if (self.completion) {
+            self.completion();
+        }
+    }
+    return writtenCount;
+}
+
+#pragma mark - Rows
+
+- (NSUInteger)rowOfConstraint:(MASViewConstraint *)constraint {
+    CFTypeRef pointer = (__bridge CFTypeRef)constraint;
+    for (NSUInteger i = 0; i < _count; i++) {
+        if (_constraints[i] == pointer) return i;
+    }
+    return NSNotFound;
+}
+
+- (NSUInteger)addRowForConstraint:(MASViewConstraint *)constraint {
+    if (_count == _capacity) {
+        NSUInteger capacity = MAX(_capacity * 2, 8);
+        // columns grown before a failure are merely larger than needed, the capacity only moves once all of them grew
+        BOOL grown = MASConstraintAnimatorGrowColumn((void **)&_constraints, capacity, sizeof(CFTypeRef))
+            && MASConstraintAnimatorGrowColumn((void **)&_fromConstants, capacity, sizeof(CGFloat))
+            && MASConstraintAnimatorGrowColumn((void **)&_toConstants, capacity, sizeof(CGFloat))
+            && MASConstraintAnimatorGrowColumn((void **)&_writtenConstants, capacity, sizeof(CGFloat))
+            && MASConstraintAnimatorGrowColumn((void **)&_startTimes, capacity, sizeof(CFTimeInterval))
+            && MASConstraintAnimatorGrowColumn((void **)&_durations, capacity, sizeof(CFTimeInterval))
+            && MASConstraintAnimatorGrowColumn((void **)&_curves, capacity, sizeof(MASAnimationCurve));
+        if (!grown) return NSNotFound;
+        _capacity = capacity;
+    }
+    _constraints[_count] = CFBridgingRetain(constraint);
+    _layoutRootNeedsUpdate = YES;
+    return _count++;
+}
+
+- (void)removeRow:(NSUInteger)row {
+    CFRelease(_constraints[row]);
+    NSUInteger last = --_count;
+    if (row != last) {
+        _constraints[row] = _constraints[last];
+        _fromConstants[row] = _fromConstants[last];
+        _toConstants[row] = _toConstants[last];
+        _writtenConstants[row] = _writtenConstants[last];
+        _startTimes[row] = _startTimes[last];
+        _durations[row] = _durations[last];
+        _curves[row] = _curves[last];
+    }
+    _layoutRootNeedsUpdate = YES;
+}
+
+#pragma mark - Layout
+
+- (void)layoutIfNeeded {
+    if (_layoutRootNeedsUpdate) {
+        _layoutRootNeedsUpdate = NO;
+        _layoutRoot = [self closestCommonInstalledView];
+    }
+    MAS_VIEW *layoutRoot = _layoutRoot;
+    if (layoutRoot) {
+        [self layoutView:layoutRoot];
+        return;
+    }
+    // installed views in separate hierarchies, or none installed
+    for (NSUInteger i = 0; i < _count; i++) {
+        [self layoutView:((__bridge MASViewConstraint *)_constraints[i]).installedView];
+    }
+}
+
+- (MAS_VIEW *)closestCommonInstalledView {
+    __block MAS_VIEW *commonView = nil;
+    [MAS_VIEW mas_performWithCommonSuperviewCache:^{
+        for (NSUInteger i = 0; i < self->_count; i++) {
+            MAS_VIEW *installedView = ((__bridge MASViewConstraint *)self->_constraints[i]).installedView;
+            if (!installedView) continue;
+            if (!commonView) {
+                commonView = installedView;
+                continue;
+            }
+            commonView = [commonView mas_closestCommonSuperview:installedView];
+            if (!commonView) return;
+        }
+    }];
+    return commonView;
+}
+
+- (void)layoutView:(MAS_VIEW *)view {
+#if TARGET_OS_IPHONE || TARGET_OS_TV
+    [view layoutIfNeeded];
+#else
+    [view layoutSubtreeIfNeeded];
+#endif
+}
+
+#pragma mark - Display link
+
+- (void)updateDisplayLink {
+    if (!_ticksWithDisplay) return;
+    BOOL running = _count > 0;
+
+    if (running && !_displayLink) {
+        MASConstraintAnimatorTicker *ticker = [MASConstraintAnimatorTicker new];
+        ticker.animator = self;
+#if TARGET_OS_IPHONE || TARGET_OS_TV
+        CADisplayLink *displayLink = [CADisplayLink displayLinkWithTarget:ticker selector:@selector(tick:)];
+        [displayLink addToRunLoop:NSRunLoop.mainRunLoop forMode:NSRunLoopCommonModes];
+        _displayLink = displayLink;
+#else
+        NSTimer *timer = [NSTimer timerWithTimeInterval:1.0 / 60 target:ticker selector:@selector(tick:) userInfo:nil repeats:YES];
+        [NSRunLoop.mainRunLoop addTimer:timer forMode:NSRunLoopCommonModes];
+        _displayLink = timer;
+#endif
+    } else if (!running && _displayLink) {
+        [_displayLink invalidate];
+        _displayLink = nil;
+    }
+}
+
+@end
@@ -0,0 +1,88 @@
+//
+//  MASConstraintBatch.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+
+/**
+ *  Collects the NSLayoutConstraints which Masonry activates and deactivates while the batch is open
+ *  and applies them with single bulk calls to +[NSLayoutConstraint deactivateConstraints:] and +[NSLayoutConstraint activateConstraints:]
+ *  instead of one round-trip into the layout engine per constraint.
+ *
+ *  Every MASConstraintMaker installs within a batch, use performBatch: to share one batch across several views.
+ *  Batches must only be used on the main thread.
+ */
+@interface MASConstraintBatch : NSObject
+
+/**
+ *	The number of constraints activated when the batch was committed
+ */
+@property (nonatomic, assign, readonly) NSUInteger activatedCount;
+
+/**
+ *	The number of constraints deactivated when the batch was committed
+ */
+@property (nonatomic, assign, readonly) NSUInteger deactivatedCount;
+
+/**
+ *	The number of calls made into the layout engine when the batch was committed
+ */
+@property (nonatomic, assign, readonly) NSUInteger engineCallCount;
+
+/**
+ *	The number of layout engine calls avoided compared to activating and deactivating each constraint individually
+ */
+@property (nonatomic, assign, readonly) NSUInteger savedEngineCallCount;
+
+/**
+ *	The constraints which were activated when the batch was committed, in the order they were queued
+ */
+@property (nonatomic, copy, readonly) NSArray *activatedConstraints;
+
+/**
+ *	Whether or not the batch has been committed
+ */
+@property (nonatomic, assign, readonly, getter=isCommitted) BOOL committed;
+
+/**
+ *	Returns the outermost batch currently open, nil if there is none
+ */
++ (instancetype)currentBatch;
+
+/**
+ *	Whether or not the running OS supports bulk activation, performBatch: just executes its block when it does not
+ */
++ (BOOL)isSupported;
+
+/**
+ *  Opens a batch for the duration of the block and commits it once the block has finished executing.
+ *  If a batch is already open the block joins it and nothing is committed until the outermost batch finishes.
+ *
+ *  @param block scope within which any number of mas_makeConstraints:, mas_updateConstraints: or mas_remakeConstraints: calls can be made
+ *
+ *  @return the batch the block contributed to, nil if batching is not supported
+ */
++ (instancetype)performBatch:(void(NS_NOESCAPE ^)(void))block;
+
+/**
+ *	Queues a constraint to be activated when the batch is committed.
+ *  Cancels a pending deactivation of the same constraint.
+ */
+- (void)activateConstraint:(NSLayoutConstraint *)constraint;
+
+/**
+ *	Queues a constraint to be deactivated when the batch is committed.
+ *  Cancels a pending activation of the same constraint.
+ */
+- (void)deactivateConstraint:(NSLayoutConstraint *)constraint;
+
+/**
+ *	Whether or not the constraint will be active once the current batch, if any, is committed
+ */
++ (BOOL)isConstraintActive:(NSLayoutConstraint *)constraint;
+
+@end
@@ -0,0 +1,121 @@
+//
+//  MASConstraintBatch.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASConstraintBatch.h"
+
+@interface MASConstraintBatch ()
+
+@property (nonatomic, strong) NSMutableOrderedSet *pendingActivations;
+@property (nonatomic, strong) NSMutableOrderedSet *pendingDeactivations;
+@property (nonatomic, assign, readwrite) NSUInteger activatedCount;
+@property (nonatomic, assign, readwrite) NSUInteger deactivatedCount;
+@property (nonatomic, assign, readwrite) NSUInteger engineCallCount;
+@property (nonatomic, copy, readwrite) NSArray *activatedConstraints;
+@property (nonatomic, assign, readwrite, getter=isCommitted) BOOL committed;
+
+@end
+
+static MASConstraintBatch *MASCurrentBatch = nil;
+
+@implementation MASConstraintBatch
+
+- (id)init {
+    self = [super init];
+    if (!self) return nil;
+
+    self.pendingActivations = [NSMutableOrderedSet orderedSet];
+    self.pendingDeactivations = [NSMutableOrderedSet orderedSet];
+
+    return self;
+}
+
+#pragma mark - Public
+
++ (instancetype)currentBatch {
+    return MASCurrentBatch;
+}
+
++ (BOOL)isSupported {
+    return [NSLayoutConstraint respondsToSelector:@selector(activateConstraints:)];
+}
+
++ (instancetype)performBatch:(void(NS_NOESCAPE ^)(void))block {
+    if (MASCurrentBatch || !self.isSupported) {
+        block();
+        return MASCurrentBatch;
+    }
+
+    NSAssert([NSThread isMainThread], @"Constraint batches must be performed on the main thread");
+    MASConstraintBatch *batch = [[MASConstraintBatch alloc] init];
+    MASCurrentBatch = batch;
+    @try {
+        block();
+    } @finally {
+        MASCurrentBatch = nil;
+        [batch commit];
+    }
+    return batch;
+}
+
+- (void)activateConstraint:(NSLayoutConstraint *)constraint {
+    NSAssert(!self.committed, @"Cannot modify a batch which has already been committed");
+    if ([self.pendingDeactivations containsObject:constraint]) {
+        [self.pendingDeactivations removeObject:constraint];
+        return;
+    }
+    if (constraint.isActive) return;
+    [self.pendingActivations addObject:constraint];
+}
+
+- (void)deactivateConstraint:(NSLayoutConstraint *)constraint {
+    NSAssert(!self.committed, @"Cannot modify a batch which has already been committed");
+    if ([self.pendingActivations containsObject:constraint]) {
+        [self.pendingActivations removeObject:constraint];
+        return;
+    }
+    if (!constraint.isActive) return;
+    [self.pendingDeactivations addObject:constraint];
+}
+
++ (BOOL)isConstraintActive:(NSLayoutConstraint *)constraint {
+    MASConstraintBatch *batch = MASCurrentBatch;
+    if (batch) {
+        if ([batch.pendingActivations containsObject:constraint]) return YES;
+        if ([batch.pendingDeactivations containsObject:constraint]) return NO;
+    }
+    return constraint.isActive;
+}
+
+- (NSUInteger)savedEngineCallCount {
+    NSUInteger individualCalls = self.activatedCount + self.deactivatedCount;
+    return individualCalls > self.engineCallCount ? individualCalls - self.engineCallCount : 0;
+}
+
+#pragma mark - Private
+
+- (void)commit {
+    NSAssert(!self.committed, @"Batch has already been committed");
+    self.committed = YES;
+
+    // deactivate first so that replaced constraints never conflict with their replacements
+    if (self.pendingDeactivations.count) {
+        [NSLayoutConstraint deactivateConstraints:self.pendingDeactivations.array];
+        self.deactivatedCount = self.pendingDeactivations.count;
+        self.engineCallCount++;
+    }
+    if (self.pendingActivations.count) {
+        self.activatedConstraints = self.pendingActivations.array;
+        [NSLayoutConstraint activateConstraints:self.activatedConstraints];
+        self.activatedCount = self.activatedConstraints.count;
+        self.engineCallCount++;
+    }
+    [self.pendingDeactivations removeAllObjects];
+    [self.pendingActivations removeAllObjects];
+}
+
+@end
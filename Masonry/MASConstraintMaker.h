@@ -7,6 +7,7 @@
 //
 
 #import "MASConstraint.h"
+#import "MASConstraintBatch.h"
 #import "MASUtilities.h"
 
 typedef NS_OPTIONS(NSInteger, MASAttribute) {
@@ -117,6 +118,12 @@ typedef NS_OPTIONS(NSInteger, MASAttribute) {
  */
 @property (nonatomic, assign) BOOL removeExisting;
 
+/**
+ *  The batch which the last install was applied through, reports how many layout engine calls were saved.
+ *  Shared with other makers when installed within +[MASConstraintBatch performBatch:]
+ */
+@property (nonatomic, strong, readonly) MASConstraintBatch *batch;
+
 /**
  *	initialises the maker with a default view
  *
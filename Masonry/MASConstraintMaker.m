@@ -8,15 +8,21 @@
 
 #import "MASConstraintMaker.h"
 #import "MASViewConstraint.h"
+#import "MASViewConstraint+Private.h"
 #import "MASCompositeConstraint.h"
 #import "MASConstraint+Private.h"
+#import "MASConstraintBatch.h"
 #import "MASViewAttribute.h"
 #import "View+MASAdditions.h"
+#import "MASTrace+Private.h"
+#import "MASChurn+Private.h"
+#import "MASLayoutTransaction+Private.h"
 
 @interface MASConstraintMaker () <MASConstraintDelegate>
 
 @property (nonatomic, weak) MAS_VIEW *view;
 @property (nonatomic, strong) NSMutableArray *constraints;
+@property (nonatomic, strong, readwrite) MASConstraintBatch *batch;
 
 @end
 
@@ -32,44 +38,92 @@
     return self;
 }
 
+- (void)addPendingConstraint:(MASConstraint *)constraint {
+    constraint.delegate = self;
+    constraint.delegateIndex = self.constraints.count;
+    [self.constraints addObject:constraint];
+}
+
 - (NSArray *)install {
-    if (self.removeExisting) {
-        NSArray *installedConstraints = [MASViewConstraint installedConstraintsForView:self.view];
-        for (MASConstraint *constraint in installedConstraints) {
-            [constraint uninstall];
-        }
-    }
+    MAS_TRACE_BEGIN(span, "MASConstraintMaker install");
     NSArray *constraints = self.constraints.copy;
-    for (MASConstraint *constraint in constraints) {
-        constraint.updateExisting = self.updateExisting;
-        [constraint install];
+    if (self.updateExisting && !self.removeExisting && [MASLayoutTransaction isBuffering]) {
+        // installed when the transaction flushes, collapsed with any later update of the same constraint
+        NSMutableArray *viewConstraints = [NSMutableArray arrayWithCapacity:constraints.count];
+        for (MASConstraint *constraint in constraints) {
+            [constraint addViewConstraintsToArray:viewConstraints];
+        }
+        MASLayoutTransactionBufferConstraints(viewConstraints);
+        [self.constraints removeAllObjects];
+        MAS_TRACE_END(span, self.view.mas_key, constraints.count, MASTraceModeUpdate);
+        return constraints;
     }
+    // buffered updates were made first, they must not land on top of this make or remake
+    MASLayoutTransactionFlushIfNeeded();
+    NSUInteger repeatedCount = [self repeatedConstraintCount];
+    // uninstalls and installs are applied to the layout engine in bulk once the outermost batch finishes
+    self.batch = [MASConstraintBatch performBatch:^{
+        [MAS_VIEW mas_performWithCommonSuperviewCache:^{
+            if (self.removeExisting) {
+                // constraints matching an installed one are kept, only the differences reach the layout engine
+                NSMutableArray *viewConstraints = [NSMutableArray arrayWithCapacity:constraints.count];
+                for (MASConstraint *constraint in constraints) {
+                    [constraint addViewConstraintsToArray:viewConstraints];
+                }
+                [MASViewConstraint remakeConstraintsOfView:self.view withConstraints:viewConstraints];
+                return;
+            }
+            for (MASConstraint *constraint in constraints) {
+                constraint.updateExisting = self.updateExisting;
+                [constraint install];
+            }
+        }];
+    }];
     [self.constraints removeAllObjects];
+    if ([self repeatedConstraintCount] != repeatedCount) {
+        MASChurnRecordRepeatedPass(self.view);
+    }
+    MAS_TRACE_END(span, self.view.mas_key, constraints.count,
+                  self.removeExisting ? MASTraceModeRemake : (self.updateExisting ? MASTraceModeUpdate : MASTraceModeMake));
     return constraints;
 }
 
+- (NSUInteger)repeatedConstraintCount {
+    // mas_updateConstraints: exists to update constants in place, a make or remake reproducing existing constraints is wasted work
+    NSUInteger count = MASChurnCountForView(self.view, MASChurnEventReinstalled);
+    if (self.removeExisting) {
+        count += MASChurnCountForView(self.view, MASChurnEventUpdatedInPlace);
+    }
+    return count;
+}
+
 #pragma mark - MASConstraintDelegate
 
 - (void)constraint:(MASConstraint *)constraint shouldBeReplacedWithConstraint:(MASConstraint *)replacementConstraint {
-    NSUInteger index = [self.constraints indexOfObject:constraint];
-    NSAssert(index != NSNotFound, @"Could not find constraint %@", constraint);
+    [self replacePendingConstraintAtIndex:constraint.delegateIndex withConstraint:replacementConstraint];
+}
+
+- (void)replacePendingConstraintAtIndex:(NSUInteger)index withConstraint:(MASConstraint *)replacementConstraint {
+    NSAssert(index < self.constraints.count, @"Could not find constraint to replace with %@", replacementConstraint);
+    if (index >= self.constraints.count) return;
+    replacementConstraint.delegate = self;
+    replacementConstraint.delegateIndex = index;
     [self.constraints replaceObjectAtIndex:index withObject:replacementConstraint];
 }
 
 - (MASConstraint *)constraint:(MASConstraint *)constraint addConstraintWithLayoutAttribute:(NSLayoutAttribute)layoutAttribute {
-    MASViewAttribute *viewAttribute = [[MASViewAttribute alloc] initWithView:self.view layoutAttribute:layoutAttribute];
+    MASViewAttribute *viewAttribute = [MASViewAttribute attributeWithView:self.view layoutAttribute:layoutAttribute];
     MASViewConstraint *newConstraint = [[MASViewConstraint alloc] initWithFirstViewAttribute:viewAttribute];
     if ([constraint isKindOfClass:MASViewConstraint.class]) {
-        //replace with composite constraint
+        //replace with composite constraint, adopting the constraint moves it to the composite's first index
+        NSUInteger index = constraint.delegateIndex;
         NSArray *children = @[constraint, newConstraint];
         MASCompositeConstraint *compositeConstraint = [[MASCompositeConstraint alloc] initWithChildren:children];
-        compositeConstraint.delegate = self;
-        [self constraint:constraint shouldBeReplacedWithConstraint:compositeConstraint];
+        [self replacePendingConstraintAtIndex:index withConstraint:compositeConstraint];
         return compositeConstraint;
     }
     if (!constraint) {
-        newConstraint.delegate = self;
-        [self.constraints addObject:newConstraint];
+        [self addPendingConstraint:newConstraint];
     }
     return newConstraint;
 }
@@ -88,44 +142,33 @@
     
     NSAssert((attrs & anyAttribute) != 0, @"You didn't pass any attribute to make.attributes(...)");
     
-    NSMutableArray *attributes = [NSMutableArray array];
-    
-    if (attrs & MASAttributeLeft) [attributes addObject:self.view.mas_left];
-    if (attrs & MASAttributeRight) [attributes addObject:self.view.mas_right];
-    if (attrs & MASAttributeTop) [attributes addObject:self.view.mas_top];
-    if (attrs & MASAttributeBottom) [attributes addObject:self.view.mas_bottom];
-    if (attrs & MASAttributeLeading) [attributes addObject:self.view.mas_leading];
-    if (attrs & MASAttributeTrailing) [attributes addObject:self.view.mas_trailing];
-    if (attrs & MASAttributeWidth) [attributes addObject:self.view.mas_width];
-    if (attrs & MASAttributeHeight) [attributes addObject:self.view.mas_height];
-    if (attrs & MASAttributeCenterX) [attributes addObject:self.view.mas_centerX];
-    if (attrs & MASAttributeCenterY) [attributes addObject:self.view.mas_centerY];
-    if (attrs & MASAttributeBaseline) [attributes addObject:self.view.mas_baseline];
-    if (attrs & MASAttributeFirstBaseline) [attributes addObject:self.view.mas_firstBaseline];
-    if (attrs & MASAttributeLastBaseline) [attributes addObject:self.view.mas_lastBaseline];
-    
+    // children are created in the same order as the MASAttribute options, without staging their attributes
+    static const NSLayoutAttribute layoutAttributes[] = {
+        NSLayoutAttributeLeft, NSLayoutAttributeRight, NSLayoutAttributeTop, NSLayoutAttributeBottom,
+        NSLayoutAttributeLeading, NSLayoutAttributeTrailing, NSLayoutAttributeWidth, NSLayoutAttributeHeight,
+        NSLayoutAttributeCenterX, NSLayoutAttributeCenterY, NSLayoutAttributeBaseline,
+        NSLayoutAttributeFirstBaseline, NSLayoutAttributeLastBaseline,
 #if TARGET_OS_IPHONE || TARGET_OS_TV
-    
-    if (attrs & MASAttributeLeftMargin) [attributes addObject:self.view.mas_leftMargin];
-    if (attrs & MASAttributeRightMargin) [attributes addObject:self.view.mas_rightMargin];
-    if (attrs & MASAttributeTopMargin) [attributes addObject:self.view.mas_topMargin];
-    if (attrs & MASAttributeBottomMargin) [attributes addObject:self.view.mas_bottomMargin];
-    if (attrs & MASAttributeLeadingMargin) [attributes addObject:self.view.mas_leadingMargin];
-    if (attrs & MASAttributeTrailingMargin) [attributes addObject:self.view.mas_trailingMargin];
-    if (attrs & MASAttributeCenterXWithinMargins) [attributes addObject:self.view.mas_centerXWithinMargins];
-    if (attrs & MASAttributeCenterYWithinMargins) [attributes addObject:self.view.mas_centerYWithinMargins];
-    
+        NSLayoutAttributeLeftMargin, NSLayoutAttributeRightMargin, NSLayoutAttributeTopMargin, NSLayoutAttributeBottomMargin,
+        NSLayoutAttributeLeadingMargin, NSLayoutAttributeTrailingMargin, NSLayoutAttributeCenterXWithinMargins,
+        NSLayoutAttributeCenterYWithinMargins,
 #endif
-    
-    NSMutableArray *children = [NSMutableArray arrayWithCapacity:attributes.count];
-    
-    for (MASViewAttribute *a in attributes) {
-        [children addObject:[[MASViewConstraint alloc] initWithFirstViewAttribute:a]];
+    };
+    static const NSUInteger layoutAttributeCount = sizeof(layoutAttributes) / sizeof(layoutAttributes[0]);
+
+    NSLayoutAttribute selectedAttributes[sizeof(layoutAttributes) / sizeof(layoutAttributes[0])];
+    NSUInteger count = 0;
+    for (NSUInteger i = 0; i < layoutAttributeCount; i++) {
+        if (attrs & (1 << layoutAttributes[i])) {
+            selectedAttributes[count++] = layoutAttributes[i];
+        }
     }
-    
-    MASCompositeConstraint *constraint = [[MASCompositeConstraint alloc] initWithChildren:children];
-    constraint.delegate = self;
-    [self.constraints addObject:constraint];
+    return [self addConstraintWithLayoutAttributes:selectedAttributes count:count];
+}
+
+- (MASConstraint *)addConstraintWithLayoutAttributes:(const NSLayoutAttribute *)layoutAttributes count:(NSUInteger)count {
+    MASCompositeConstraint *constraint = [[MASCompositeConstraint alloc] initWithView:self.view layoutAttributes:layoutAttributes count:count];
+    [self addPendingConstraint:constraint];
     return constraint;
 }
 
@@ -232,16 +275,23 @@
 
 #pragma mark - composite Attributes
 
+// same children and order as the equivalent attributes(...), without scanning the options
+
 - (MASConstraint *)edges {
-    return [self addConstraintWithAttributes:MASAttributeTop | MASAttributeLeft | MASAttributeRight | MASAttributeBottom];
+    static const NSLayoutAttribute layoutAttributes[] = {
+        NSLayoutAttributeLeft, NSLayoutAttributeRight, NSLayoutAttributeTop, NSLayoutAttributeBottom
+    };
+    return [self addConstraintWithLayoutAttributes:layoutAttributes count:4];
 }
 
 - (MASConstraint *)size {
-    return [self addConstraintWithAttributes:MASAttributeWidth | MASAttributeHeight];
+    static const NSLayoutAttribute layoutAttributes[] = { NSLayoutAttributeWidth, NSLayoutAttributeHeight };
+    return [self addConstraintWithLayoutAttributes:layoutAttributes count:2];
 }
 
 - (MASConstraint *)center {
-    return [self addConstraintWithAttributes:MASAttributeCenterX | MASAttributeCenterY];
+    static const NSLayoutAttribute layoutAttributes[] = { NSLayoutAttributeCenterX, NSLayoutAttributeCenterY };
+    return [self addConstraintWithLayoutAttributes:layoutAttributes count:2];
 }
 
 #pragma mark - grouping
@@ -0,0 +1,31 @@
+//
+//  MASConstraintPool+Private.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASConstraintPool.h"
+
+@class MASLayoutConstraint;
+@class MASConstraintSignature;
+
+/**
+ *	Whether or not the pool is enabled, checked before building a signature to look up
+ */
+extern BOOL MASConstraintPoolEnabled;
+
+/**
+ *	Takes an inactive layout constraint matching a signature from the pool of a view
+ *
+ *	@return	a constraint that is no longer referenced by any MASConstraint, or nil
+ */
+MASLayoutConstraint *MASConstraintPoolDequeue(MAS_VIEW *view, MASConstraintSignature *signature);
+
+/**
+ *	Moves a deactivated layout constraint into the pool of a view
+ *
+ *	@return	NO if the pool is disabled or full, in which case the caller keeps the constraint
+ */
+BOOL MASConstraintPoolEnqueue(MAS_VIEW *view, MASLayoutConstraint *layoutConstraint);
@@ -0,0 +1,55 @@
+//
+//  MASConstraintPool.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+
+/**
+ *  Opt-in recycling of the layout constraints Masonry removes, for screens that switch back and forth between layouts
+ *  with mas_remakeConstraints:, uninstall and install.
+ *
+ *  While enabled, uninstalling a MASViewConstraint deactivates its layout constraint and moves it into a pool of its first view,
+ *  and installing a constraint of that view with the same items, attributes, relation, multiplier and priority reuses it
+ *  with the new constant instead of allocating a new one. Within a constraint batch a reused constraint never leaves the layout engine.
+ *
+ *  Only layout constraints are recycled. A MASConstraint handle returned by Masonry is never reused or repointed:
+ *  once uninstalled it gives up its layout constraint, and installing it again takes one from the pool or creates a new one.
+ *  Layout constraints held onto from outside Masonry, eg through -[NSLayoutConstraint mas_key] lookups, must not be used
+ *  after their MASConstraint was uninstalled, as they may already belong to another one.
+ *
+ *  Requires the active property of NSLayoutConstraint, pools are drained on memory warnings. Must be used on the main thread.
+ */
+@interface MASConstraintPool : NSObject
+
+/**
+ *	Whether or not uninstalled layout constraints are recycled, NO by default
+ */
++ (BOOL)isEnabled;
++ (void)setEnabled:(BOOL)enabled;
+
+/**
+ *	The maximum number of layout constraints kept per view, 32 by default
+ */
++ (NSUInteger)maximumCountPerView;
++ (void)setMaximumCountPerView:(NSUInteger)maximumCountPerView;
+
+/**
+ *	Releases every pooled layout constraint
+ */
++ (void)drain;
+
+/**
+ *	Number of layout constraints moved into a pool
+ */
++ (NSUInteger)recycleCount;
+
+/**
+ *	Number of layout constraints taken from a pool instead of being allocated
+ */
++ (NSUInteger)reuseCount;
+
+@end
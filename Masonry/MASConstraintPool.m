@@ -0,0 +1,121 @@
+//
+//  MASConstraintPool.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASConstraintPool+Private.h"
+#import "MASConstraintSignature.h"
+#import "MASLayoutConstraint.h"
+#import "MASViewRecord.h"
+
+BOOL MASConstraintPoolEnabled = NO;
+
+// main thread only
+static NSUInteger MASConstraintPoolMaximumCountPerView = 32;
+static NSUInteger MASConstraintPoolRecycleCount;
+static NSUInteger MASConstraintPoolReuseCount;
+static NSHashTable *MASConstraintPoolRecords;
+
+MASLayoutConstraint *MASConstraintPoolDequeue(MAS_VIEW *view, MASConstraintSignature *signature) {
+    if (!MASConstraintPoolEnabled) return nil;
+    MASViewRecord *record = [MASViewRecord existingRecordForItem:view];
+    NSMutableDictionary *pool = record ? record->_recycledLayoutConstraints : nil;
+    NSMutableArray *matches = pool[signature];
+    if (!matches) return nil;
+
+    MASLayoutConstraint *layoutConstraint = nil;
+    while (matches.count && !layoutConstraint) {
+        layoutConstraint = matches.lastObject;
+        [matches removeLastObject];
+        record->_recycledLayoutConstraintCount--;
+        // items are compared by address, an item may have been deallocated and its address reused since
+        if (layoutConstraint.firstItem != signature.firstItem || layoutConstraint.secondItem != signature.secondItem) {
+            layoutConstraint = nil;
+        }
+    }
+    if (!matches.count) {
+        [pool removeObjectForKey:signature];
+    }
+    if (layoutConstraint) {
+        MASConstraintPoolReuseCount++;
+    }
+    return layoutConstraint;
+}
+
+BOOL MASConstraintPoolEnqueue(MAS_VIEW *view, MASLayoutConstraint *layoutConstraint) {
+    if (!MASConstraintPoolEnabled || !view || ![layoutConstraint isKindOfClass:MASLayoutConstraint.class]) return NO;
+    MASViewRecord *record = [MASViewRecord recordForItem:view];
+    if (record->_recycledLayoutConstraintCount >= MASConstraintPoolMaximumCountPerView) return NO;
+
+    if (!record->_recycledLayoutConstraints) {
+        record->_recycledLayoutConstraints = [NSMutableDictionary dictionary];
+        if (!MASConstraintPoolRecords) {
+            MASConstraintPoolRecords = [NSHashTable weakObjectsHashTable];
+        }
+        [MASConstraintPoolRecords addObject:record];
+    }
+    MASConstraintSignature *signature = [MASConstraintSignature signatureWithLayoutConstraint:layoutConstraint];
+    NSMutableArray *matches = record->_recycledLayoutConstraints[signature];
+    if (!matches) {
+        matches = [NSMutableArray arrayWithCapacity:1];
+        record->_recycledLayoutConstraints[signature] = matches;
+    }
+    [matches addObject:layoutConstraint];
+    record->_recycledLayoutConstraintCount++;
+    MASConstraintPoolRecycleCount++;
+    return YES;
+}
+
+@implementation MASConstraintPool
+
++ (BOOL)isEnabled {
+    return MASConstraintPoolEnabled;
+}
+
++ (void)setEnabled:(BOOL)enabled {
+    MASConstraintPoolEnabled = enabled;
+    if (!enabled) {
+        [self drain];
+        return;
+    }
+#if TARGET_OS_IPHONE || TARGET_OS_TV
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        [[NSNotificationCenter defaultCenter] addObserverForName:UIApplicationDidReceiveMemoryWarningNotification
+                                                          object:nil
+                                                           queue:NSOperationQueue.mainQueue
+                                                      usingBlock:^(NSNotification *note) {
+            [MASConstraintPool drain];
+        }];
+    });
+#endif
+}
+
++ (NSUInteger)maximumCountPerView {
+    return MASConstraintPoolMaximumCountPerView;
+}
+
++ (void)setMaximumCountPerView:(NSUInteger)maximumCountPerView {
+    MASConstraintPoolMaximumCountPerView = maximumCountPerView;
+}
+
++ (void)drain {
+    for (MASViewRecord *record in MASConstraintPoolRecords) {
+        record->_recycledLayoutConstraints = nil;
+        record->_recycledLayoutConstraintCount = 0;
+    }
+    [MASConstraintPoolRecords removeAllObjects];
+}
+
++ (NSUInteger)recycleCount {
+    return MASConstraintPoolRecycleCount;
+}
+
++ (NSUInteger)reuseCount {
+    return MASConstraintPoolReuseCount;
+}
+
+@end
@@ -0,0 +1,48 @@
+//
+//  MASConstraintSignature.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+
+/**
+ *  An immutable value describing the structure of a NSLayoutConstraint,
+ *  that is every property apart from the only mutable property constant.
+ *  Two constraints with equal signatures are considered similar by mas_updateConstraints:
+ *
+ *  Items are compared by identity and are not retained, a signature should not outlive the constraint it was created from.
+ */
+@interface MASConstraintSignature : NSObject <NSCopying>
+
+@property (nonatomic, unsafe_unretained, readonly) id firstItem;
+@property (nonatomic, unsafe_unretained, readonly) id secondItem;
+@property (nonatomic, assign, readonly) NSLayoutAttribute firstAttribute;
+@property (nonatomic, assign, readonly) NSLayoutAttribute secondAttribute;
+@property (nonatomic, assign, readonly) NSLayoutRelation relation;
+@property (nonatomic, assign, readonly) CGFloat multiplier;
+@property (nonatomic, assign, readonly) MASLayoutPriority priority;
+
+/**
+ *	Creates a signature from the structural properties of a layout constraint
+ *
+ *	@param	layoutConstraint	the constraint to describe
+ *
+ *	@return	a new signature
+ */
++ (instancetype)signatureWithLayoutConstraint:(NSLayoutConstraint *)layoutConstraint;
+
+/**
+ *	The designated initializer.
+ */
+- (id)initWithFirstItem:(id)firstItem
+         firstAttribute:(NSLayoutAttribute)firstAttribute
+               relation:(NSLayoutRelation)relation
+             secondItem:(id)secondItem
+        secondAttribute:(NSLayoutAttribute)secondAttribute
+             multiplier:(CGFloat)multiplier
+               priority:(MASLayoutPriority)priority;
+
+@end
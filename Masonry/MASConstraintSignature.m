@@ -0,0 +1,76 @@
+//
+//  MASConstraintSignature.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASConstraintSignature.h"
+
+@implementation MASConstraintSignature
+
++ (instancetype)signatureWithLayoutConstraint:(NSLayoutConstraint *)layoutConstraint {
+    return [[self alloc] initWithFirstItem:layoutConstraint.firstItem
+                            firstAttribute:layoutConstraint.firstAttribute
+                                  relation:layoutConstraint.relation
+                                secondItem:layoutConstraint.secondItem
+                           secondAttribute:layoutConstraint.secondAttribute
+                                multiplier:layoutConstraint.multiplier
+                                  priority:layoutConstraint.priority];
+}
+
+- (id)initWithFirstItem:(id)firstItem
+         firstAttribute:(NSLayoutAttribute)firstAttribute
+               relation:(NSLayoutRelation)relation
+             secondItem:(id)secondItem
+        secondAttribute:(NSLayoutAttribute)secondAttribute
+             multiplier:(CGFloat)multiplier
+               priority:(MASLayoutPriority)priority {
+    self = [super init];
+    if (!self) return nil;
+
+    _firstItem = firstItem;
+    _firstAttribute = firstAttribute;
+    _relation = relation;
+    _secondItem = secondItem;
+    _secondAttribute = secondAttribute;
+    _multiplier = multiplier;
+    _priority = priority;
+
+    return self;
+}
+
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(NSZone __unused *)zone {
+    // immutable
+    return self;
+}
+
+#pragma mark - equality
+
+- (BOOL)isEqual:(MASConstraintSignature *)signature {
+    if (self == signature) return YES;
+    if (![signature isKindOfClass:MASConstraintSignature.class]) return NO;
+
+    return self.firstItem == signature.firstItem
+        && self.secondItem == signature.secondItem
+        && self.firstAttribute == signature.firstAttribute
+        && self.secondAttribute == signature.secondAttribute
+        && self.relation == signature.relation
+        && self.multiplier == signature.multiplier
+        && self.priority == signature.priority;
+}
+
+- (NSUInteger)hash {
+    NSUInteger hash = (NSUInteger)(__bridge void *)self.firstItem;
+    hash = MAS_NSUINTROTATE(hash, MAS_NSUINT_BIT / 2) ^ (NSUInteger)(__bridge void *)self.secondItem;
+    hash = MAS_NSUINTROTATE(hash, 7) ^ (NSUInteger)self.firstAttribute;
+    hash = MAS_NSUINTROTATE(hash, 7) ^ (NSUInteger)self.secondAttribute;
+    hash = MAS_NSUINTROTATE(hash, 3) ^ (NSUInteger)(self.relation + 1);
+    hash = MAS_NSUINTROTATE(hash, 11) ^ (NSUInteger)self.priority;
+    return hash;
+}
+
+@end
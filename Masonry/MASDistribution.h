@@ -0,0 +1,89 @@
+//
+//  MASDistribution.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+#import "NSArray+MASAdditions.h"
+
+/**
+ *  How a MASDistribution sizes its views
+ */
+typedef NS_ENUM(NSUInteger, MASDistributionType) {
+    /** the spacing between views is fixed and all views share the remaining length */
+    MASDistributionTypeFixedSpacing,
+    /** every view has a fixed length and the spacing between views is what remains */
+    MASDistributionTypeFixedItemLength,
+};
+
+/**
+ *  Distributes views along an axis of their closest common superview.
+ *
+ *  All constraints are created and installed in a single batch and stay owned by the distribution,
+ *  so changing the spacing or item length later only patches the constants of the installed layout constraints
+ *  instead of removing and recreating them. Must be used on the main thread.
+ */
+@interface MASDistribution : NSObject
+
+/**
+ *	Installs a distribution with fixed spacing
+ *
+ *	@param	views	two or more views sharing a common superview
+ *	@param	axisType	which axis to distribute the views along
+ *	@param	spacing	the spacing between each view
+ *	@param	leadSpacing	the spacing before the first view and the container
+ *	@param	tailSpacing	the spacing after the last view and the container
+ */
++ (instancetype)distributionOfViews:(NSArray *)views alongAxis:(MASAxisType)axisType
+                   withFixedSpacing:(CGFloat)spacing leadSpacing:(CGFloat)leadSpacing tailSpacing:(CGFloat)tailSpacing;
+
+/**
+ *	Installs a distribution with a fixed length for each view
+ *
+ *	@param	views	two or more views sharing a common superview
+ *	@param	axisType	which axis to distribute the views along
+ *	@param	itemLength	the length of each view
+ *	@param	leadSpacing	the spacing before the first view and the container
+ *	@param	tailSpacing	the spacing after the last view and the container
+ */
++ (instancetype)distributionOfViews:(NSArray *)views alongAxis:(MASAxisType)axisType
+                withFixedItemLength:(CGFloat)itemLength leadSpacing:(CGFloat)leadSpacing tailSpacing:(CGFloat)tailSpacing;
+
+@property (nonatomic, copy, readonly) NSArray *views;
+@property (nonatomic, assign, readonly) MASAxisType axisType;
+@property (nonatomic, assign, readonly) MASDistributionType type;
+
+/**
+ *	The spacing between each view, only settable for MASDistributionTypeFixedSpacing
+ */
+@property (nonatomic, assign) CGFloat spacing;
+
+/**
+ *	The length of each view, only settable for MASDistributionTypeFixedItemLength
+ */
+@property (nonatomic, assign) CGFloat itemLength;
+
+/**
+ *	The spacing before the first view and the container
+ */
+@property (nonatomic, assign) CGFloat leadSpacing;
+
+/**
+ *	The spacing after the last view and the container
+ */
+@property (nonatomic, assign) CGFloat tailSpacing;
+
+/**
+ *	The MASConstraints installed by the distribution
+ */
+@property (nonatomic, copy, readonly) NSArray *constraints;
+
+/**
+ *	Removes all constraints of the distribution, after which changing its metrics has no effect
+ */
+- (void)uninstall;
+
+@end
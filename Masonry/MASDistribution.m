@@ -0,0 +1,236 @@
+//
+//  MASDistribution.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASDistribution.h"
+#import "MASViewConstraint.h"
+#import "MASConstraintBatch.h"
+#import "View+MASAdditions.h"
+#import "MASTrace+Private.h"
+
+@interface NSArray (MASDistributionCommonSuperview)
+
+- (MAS_VIEW *)mas_commonSuperviewOfViews;
+
+@end
+
+@interface MASDistribution ()
+
+@property (nonatomic, copy, readwrite) NSArray *views;
+@property (nonatomic, assign, readwrite) MASAxisType axisType;
+@property (nonatomic, assign, readwrite) MASDistributionType type;
+@property (nonatomic, weak) MAS_VIEW *superview;
+
+@property (nonatomic, strong) NSMutableArray *installedConstraints;
+@property (nonatomic, strong) MASConstraint *leadConstraint;
+@property (nonatomic, strong) MASConstraint *tailConstraint;
+// fixed spacing: the spacing before each view but the first
+@property (nonatomic, strong) NSMutableArray *spacingConstraints;
+// fixed item length: the length of each view
+@property (nonatomic, strong) NSMutableArray *lengthConstraints;
+// fixed item length: the trailing edge of each view but the first and last
+@property (nonatomic, strong) NSMutableArray *positionConstraints;
+
+@end
+
+@implementation MASDistribution
+
++ (instancetype)distributionOfViews:(NSArray *)views alongAxis:(MASAxisType)axisType
+                   withFixedSpacing:(CGFloat)spacing leadSpacing:(CGFloat)leadSpacing tailSpacing:(CGFloat)tailSpacing {
+    return [[self alloc] initWithViews:views axisType:axisType type:MASDistributionTypeFixedSpacing
+                                metric:spacing leadSpacing:leadSpacing tailSpacing:tailSpacing];
+}
+
++ (instancetype)distributionOfViews:(NSArray *)views alongAxis:(MASAxisType)axisType
+                withFixedItemLength:(CGFloat)itemLength leadSpacing:(CGFloat)leadSpacing tailSpacing:(CGFloat)tailSpacing {
+    return [[self alloc] initWithViews:views axisType:axisType type:MASDistributionTypeFixedItemLength
+                                metric:itemLength leadSpacing:leadSpacing tailSpacing:tailSpacing];
+}
+
+- (id)initWithViews:(NSArray *)views axisType:(MASAxisType)axisType type:(MASDistributionType)type
+             metric:(CGFloat)metric leadSpacing:(CGFloat)leadSpacing tailSpacing:(CGFloat)tailSpacing {
+    if (views.count < 2) {
+        NSAssert(views.count > 1, @"views to distribute need to bigger than one");
+        return nil;
+    }
+    self = [super init];
+    if (!self) return nil;
+
+    self.views = views;
+    self.axisType = axisType;
+    self.type = type;
+    self.superview = [views mas_commonSuperviewOfViews];
+    _leadSpacing = leadSpacing;
+    _tailSpacing = tailSpacing;
+    if (type == MASDistributionTypeFixedSpacing) {
+        _spacing = metric;
+    } else {
+        _itemLength = metric;
+    }
+
+    MAS_TRACE_BEGIN(span, "MASDistribution install");
+    [MASConstraintBatch performBatch:^{
+        [MAS_VIEW mas_performWithCommonSuperviewCache:^{
+            [self installConstraints];
+        }];
+    }];
+    MAS_TRACE_END(span, nil, self.installedConstraints.count, MASTraceModeMake);
+
+    return self;
+}
+
+#pragma mark - Installing
+
+- (NSLayoutAttribute)leadAttribute {
+    return self.axisType == MASAxisTypeHorizontal ? NSLayoutAttributeLeft : NSLayoutAttributeTop;
+}
+
+- (NSLayoutAttribute)tailAttribute {
+    return self.axisType == MASAxisTypeHorizontal ? NSLayoutAttributeRight : NSLayoutAttributeBottom;
+}
+
+- (NSLayoutAttribute)lengthAttribute {
+    return self.axisType == MASAxisTypeHorizontal ? NSLayoutAttributeWidth : NSLayoutAttributeHeight;
+}
+
+- (MASConstraint *)constraintFromView:(MAS_VIEW *)view attribute:(NSLayoutAttribute)layoutAttribute {
+    MASViewConstraint *constraint = [[MASViewConstraint alloc] initWithFirstViewAttribute:[self attribute:layoutAttribute ofView:view]];
+    [self.installedConstraints addObject:constraint];
+    return constraint;
+}
+
+- (MASViewAttribute *)attribute:(NSLayoutAttribute)layoutAttribute ofView:(MAS_VIEW *)view {
+    return [MASViewAttribute attributeWithView:view layoutAttribute:layoutAttribute];
+}
+
+- (void)installConstraints {
+    NSUInteger count = self.views.count;
+    MAS_VIEW *superview = self.superview;
+    NSLayoutAttribute leadAttribute = self.leadAttribute;
+    NSLayoutAttribute tailAttribute = self.tailAttribute;
+    NSLayoutAttribute lengthAttribute = self.lengthAttribute;
+
+    self.installedConstraints = [NSMutableArray arrayWithCapacity:3 * count];
+    self.spacingConstraints = [NSMutableArray arrayWithCapacity:count];
+    self.lengthConstraints = [NSMutableArray arrayWithCapacity:count];
+    self.positionConstraints = [NSMutableArray arrayWithCapacity:count];
+
+    // same constraints and order as one mas_makeConstraints: per view, without a maker per view
+    MAS_VIEW *prev = nil;
+    for (NSUInteger i = 0; i < count; i++) {
+        MAS_VIEW *view = self.views[i];
+        view.translatesAutoresizingMaskIntoConstraints = NO;
+        BOOL last = i == count - 1;
+
+        if (self.type == MASDistributionTypeFixedSpacing) {
+            if (prev) {
+                [self constraintFromView:view attribute:lengthAttribute].equalTo([self attribute:lengthAttribute ofView:prev]);
+                [self.spacingConstraints addObject:[self constraintFromView:view attribute:leadAttribute]
+                    .equalTo([self attribute:tailAttribute ofView:prev]).offset(self.spacing)];
+                if (last) {
+                    self.tailConstraint = [self constraintFromView:view attribute:tailAttribute].equalTo(superview).offset(-self.tailSpacing);
+                }
+            } else {
+                self.leadConstraint = [self constraintFromView:view attribute:leadAttribute].equalTo(superview).offset(self.leadSpacing);
+            }
+        } else {
+            [self.lengthConstraints addObject:[self constraintFromView:view attribute:lengthAttribute].equalTo(@(self.itemLength))];
+            if (prev) {
+                if (last) {
+                    self.tailConstraint = [self constraintFromView:view attribute:tailAttribute].equalTo(superview).offset(-self.tailSpacing);
+                } else {
+                    [self.positionConstraints addObject:[self constraintFromView:view attribute:tailAttribute]
+                        .equalTo(superview).multipliedBy([self ratioAtIndex:i]).offset([self positionOffsetAtIndex:i])];
+                }
+            } else {
+                self.leadConstraint = [self constraintFromView:view attribute:leadAttribute].equalTo(superview).offset(self.leadSpacing);
+            }
+        }
+        prev = view;
+    }
+
+    for (MASConstraint *constraint in self.installedConstraints) {
+        [constraint install];
+    }
+}
+
+#pragma mark - Fixed item length
+
+- (CGFloat)ratioAtIndex:(NSUInteger)index {
+    return index / ((CGFloat)self.views.count - 1);
+}
+
+- (CGFloat)positionOffsetAtIndex:(NSUInteger)index {
+    // the trailing edges are interpolated between the first view's, lead + length, and the last view's, container - tail.
+    // the ratio only depends on the index, so new metrics never change the multiplier
+    CGFloat ratio = [self ratioAtIndex:index];
+    return (1 - ratio) * (self.itemLength + self.leadSpacing) - ratio * self.tailSpacing;
+}
+
+- (void)updatePositionConstraints {
+    [self.positionConstraints enumerateObjectsUsingBlock:^(MASConstraint *constraint, NSUInteger i, BOOL *stop) {
+        // the first view has a lead constraint instead
+        constraint.offset = [self positionOffsetAtIndex:i + 1];
+    }];
+}
+
+#pragma mark - Metrics
+
+- (void)setSpacing:(CGFloat)spacing {
+    NSAssert(self.type == MASDistributionTypeFixedSpacing, @"The spacing of a distribution with fixed item length follows from its item length");
+    if (self.type != MASDistributionTypeFixedSpacing || spacing == _spacing) return;
+    _spacing = spacing;
+    for (MASConstraint *constraint in self.spacingConstraints) {
+        constraint.offset = spacing;
+    }
+}
+
+- (void)setItemLength:(CGFloat)itemLength {
+    NSAssert(self.type == MASDistributionTypeFixedItemLength, @"The item length of a distribution with fixed spacing follows from its spacing");
+    if (self.type != MASDistributionTypeFixedItemLength || itemLength == _itemLength) return;
+    _itemLength = itemLength;
+    for (MASConstraint *constraint in self.lengthConstraints) {
+        constraint.offset = itemLength;
+    }
+    [self updatePositionConstraints];
+}
+
+- (void)setLeadSpacing:(CGFloat)leadSpacing {
+    if (leadSpacing == _leadSpacing) return;
+    _leadSpacing = leadSpacing;
+    self.leadConstraint.offset = leadSpacing;
+    [self updatePositionConstraints];
+}
+
+- (void)setTailSpacing:(CGFloat)tailSpacing {
+    if (tailSpacing == _tailSpacing) return;
+    _tailSpacing = tailSpacing;
+    self.tailConstraint.offset = -tailSpacing;
+    [self updatePositionConstraints];
+}
+
+#pragma mark - Constraints
+
+- (NSArray *)constraints {
+    return [self.installedConstraints copy] ?: @[];
+}
+
+- (void)uninstall {
+    [MASConstraintBatch performBatch:^{
+        for (MASConstraint *constraint in self.installedConstraints.reverseObjectEnumerator) {
+            [constraint uninstall];
+        }
+    }];
+    self.installedConstraints = nil;
+    self.leadConstraint = nil;
+    self.tailConstraint = nil;
+    self.spacingConstraints = nil;
+    self.lengthConstraints = nil;
+    self.positionConstraints = nil;
+}
+
+@end
@@ -0,0 +1,90 @@
+//
+//  MASHeadlessLayout.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+#import "MASLayoutTree.h"
+#import "MASConstraint.h"
+
+/**
+ *  Computes frames for a view hierarchy from its Masonry constraints with MASLayoutSolver,
+ *  without the UIKit/AppKit layout engine.
+ *
+ *  The hierarchy is captured once, after which layout runs on a plain data copy
+ *  and can happen on any thread. The views themselves are never modified.
+ *
+ *  Supported are constraints installed by Masonry between views of the hierarchy using the
+ *  edge, size and center attributes, intrinsic content sizes with their hugging and compression resistance
+ *  priorities, and the frames of subviews that translate their autoresizing mask into constraints.
+ *  Other constraints are skipped and counted in unsupportedConstraintCount.
+ *
+ *  Frames use a top left origin, which on OS X matches flipped views.
+ */
+@interface MASHeadlessLayout : NSObject
+
+/**
+ *	Captures a view, its subviews and their installed Masonry constraints. Must be called on the main thread.
+ *
+ *	@param	view	the root of the hierarchy, placed at the origin
+ */
+- (id)initWithView:(MAS_VIEW *)view;
+
+/**
+ *	Number of captured constraints that could not be expressed
+ */
+@property (nonatomic, assign, readonly) NSUInteger unsupportedConstraintCount;
+
+/**
+ *	Number of required constraints that conflicted with others and were broken
+ */
+@property (nonatomic, assign, readonly) NSUInteger unsatisfiableConstraintCount;
+
+/**
+ *	Lays out the captured hierarchy. Calls must not overlap, but may happen on any thread.
+ *
+ *	@param	size	the size of the root view, a negative width or height leaves that dimension to the constraints
+ */
+- (void)layoutWithSize:(CGSize)size;
+
+/**
+ *	The size of the root view that fits its content, like systemLayoutSizeFittingSize:withHorizontalFittingPriority:verticalFittingPriority:
+ *  on the captured hierarchy. Calls must not overlap with other layout calls, but may happen on any thread,
+ *  so a layout captured from a prototype cell can size many rows in the background with setIntrinsicContentSize:forView:.
+ *  frameForView: afterwards returns the frames at the fitting size.
+ *
+ *	@param	targetSize	the preferred size, eg the row width and a height of 0 for the smallest height
+ *	@param	horizontalFittingPriority	MASLayoutPriorityRequired to fix the width, or a lower priority to prefer it
+ *	@param	verticalFittingPriority	MASLayoutPriorityRequired to fix the height, or a lower priority such as MASLayoutPriorityFittingSizeLevel to prefer it
+ */
+- (CGSize)fittingSizeForTargetSize:(CGSize)targetSize
+         horizontalFittingPriority:(MASLayoutPriority)horizontalFittingPriority
+           verticalFittingPriority:(MASLayoutPriority)verticalFittingPriority;
+
+/**
+ *	Replaces the intrinsic content size captured for a view, eg with the size of text measured off the main thread.
+ *  Either dimension can be negative for no intrinsic metric. May be called on any thread, but not during other layout calls.
+ */
+- (void)setIntrinsicContentSize:(CGSize)size forView:(MAS_VIEW *)view;
+
+/**
+ *	Applies the current constants of a captured constraint, eg after changing its offset or insets.
+ *  The solver keeps its previous solution and only re-optimizes what the new constants affect,
+ *  so animating constants once per frame avoids capturing and solving the hierarchy again.
+ *  frameForView: reflects the new constants right away.
+ *
+ *	@param	constraint	a MASViewConstraint or MASCompositeConstraint that was installed when the hierarchy was captured
+ *
+ *	@return	NO if some of its constraints were not captured or can no longer be satisfied
+ */
+- (BOOL)updateConstantsOfConstraint:(MASConstraint *)constraint;
+
+/**
+ *	The frame of a captured view in its superview from the last layout, CGRectNull for views that were not captured
+ */
+- (CGRect)frameForView:(MAS_VIEW *)view;
+
+@end
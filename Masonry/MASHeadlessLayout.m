@@ -0,0 +1,211 @@
+//
+//  MASHeadlessLayout.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASHeadlessLayout.h"
+#import "MASViewConstraint.h"
+#import "MASViewConstraint+Private.h"
+#import "MASConstraint+Private.h"
+
+@interface MASHeadlessLayout ()
+
+@property (nonatomic, assign, readwrite) NSUInteger unsupportedConstraintCount;
+@property (nonatomic, assign, readwrite) NSUInteger unsatisfiableConstraintCount;
+@property (nonatomic, strong) NSMapTable *itemsByView;
+@property (nonatomic, strong) NSMapTable *handlesByLayoutConstraint;
+
+@end
+
+@implementation MASHeadlessLayout {
+    MASLayoutTree *_tree;
+}
+
+- (id)initWithView:(MAS_VIEW *)view {
+    self = [super init];
+    if (!self) return nil;
+
+    _tree = MASLayoutTreeCreate();
+    self.itemsByView = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality | NSPointerFunctionsWeakMemory
+                                             valueOptions:NSPointerFunctionsStrongMemory];
+    self.handlesByLayoutConstraint = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality | NSPointerFunctionsWeakMemory
+                                                           valueOptions:NSPointerFunctionsStrongMemory];
+
+    NSMutableArray *views = [NSMutableArray array];
+    [self captureView:view parent:MASLayoutItemNone views:views];
+    for (MAS_VIEW *capturedView in views) {
+        [self captureConstraintsOfView:capturedView];
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    MASLayoutTreeDestroy(_tree);
+}
+
+#pragma mark - capture
+
+- (void)captureView:(MAS_VIEW *)view parent:(MASLayoutItem)parent views:(NSMutableArray *)views {
+    MASLayoutItem item = parent == MASLayoutItemNone ? MASLayoutItemRoot : MASLayoutTreeAddItem(_tree, parent);
+    [self.itemsByView setObject:@(item) forKey:view];
+    [views addObject:view];
+
+    CGSize intrinsicSize = view.intrinsicContentSize;
+#if TARGET_OS_IPHONE || TARGET_OS_TV
+    MASLayoutTreeSetContentPriorities(_tree, item,
+                                      [view contentHuggingPriorityForAxis:UILayoutConstraintAxisHorizontal],
+                                      [view contentHuggingPriorityForAxis:UILayoutConstraintAxisVertical],
+                                      [view contentCompressionResistancePriorityForAxis:UILayoutConstraintAxisHorizontal],
+                                      [view contentCompressionResistancePriorityForAxis:UILayoutConstraintAxisVertical]);
+#else
+    MASLayoutTreeSetContentPriorities(_tree, item,
+                                      [view contentHuggingPriorityForOrientation:NSLayoutConstraintOrientationHorizontal],
+                                      [view contentHuggingPriorityForOrientation:NSLayoutConstraintOrientationVertical],
+                                      [view contentCompressionResistancePriorityForOrientation:NSLayoutConstraintOrientationHorizontal],
+                                      [view contentCompressionResistancePriorityForOrientation:NSLayoutConstraintOrientationVertical]);
+#endif
+    MASLayoutTreeSetIntrinsicSize(_tree, item,
+                                  intrinsicSize.width < 0 ? MAS_LAYOUT_TREE_NO_METRIC : intrinsicSize.width,
+                                  intrinsicSize.height < 0 ? MAS_LAYOUT_TREE_NO_METRIC : intrinsicSize.height);
+
+    // the autoresizing mask turns into constraints that keep the current frame
+    if (parent != MASLayoutItemNone && view.translatesAutoresizingMaskIntoConstraints) {
+        CGRect frame = view.frame;
+        const struct { MASLayoutTreeAttribute attribute; CGFloat value; } fixed[] = {
+            { MASLayoutTreeAttributeLeft, CGRectGetMinX(frame) },
+            { MASLayoutTreeAttributeTop, CGRectGetMinY(frame) },
+            { MASLayoutTreeAttributeWidth, CGRectGetWidth(frame) },
+            { MASLayoutTreeAttributeHeight, CGRectGetHeight(frame) },
+        };
+        for (size_t i = 0; i < sizeof(fixed) / sizeof(fixed[0]); i++) {
+            BOOL isPosition = fixed[i].attribute == MASLayoutTreeAttributeLeft || fixed[i].attribute == MASLayoutTreeAttributeTop;
+            MASLayoutTreeConstraint constraint = {
+                .firstItem = item,
+                .firstAttribute = fixed[i].attribute,
+                .relation = MASLayoutSolverRelationEqual,
+                .secondItem = isPosition ? parent : MASLayoutItemNone,
+                .secondAttribute = isPosition ? fixed[i].attribute : MASLayoutTreeAttributeNone,
+                .multiplier = 1,
+                .constant = fixed[i].value,
+                .priority = MASLayoutPriorityRequired,
+            };
+            [self addConstraint:&constraint handle:NULL];
+        }
+    }
+
+    for (MAS_VIEW *subview in view.subviews) {
+        [self captureView:subview parent:item views:views];
+    }
+}
+
+- (void)captureConstraintsOfView:(MAS_VIEW *)view {
+    for (MASViewConstraint *viewConstraint in [MASViewConstraint installedConstraintsForView:view]) {
+        NSLayoutConstraint *layoutConstraint = viewConstraint.layoutConstraint;
+        if (!layoutConstraint) continue;
+
+        NSNumber *firstItem = [self.itemsByView objectForKey:layoutConstraint.firstItem];
+        NSNumber *secondItem = layoutConstraint.secondItem ? [self.itemsByView objectForKey:layoutConstraint.secondItem] : @(MASLayoutItemNone);
+        if (!firstItem || !secondItem) {
+            // refers to a layout guide or a view outside the hierarchy
+            self.unsupportedConstraintCount++;
+            continue;
+        }
+
+        MASLayoutTreeConstraint constraint = {
+            .firstItem = firstItem.intValue,
+            .firstAttribute = (int32_t)layoutConstraint.firstAttribute,
+            .relation = (MASLayoutSolverRelation)layoutConstraint.relation,
+            .secondItem = secondItem.intValue,
+            .secondAttribute = (int32_t)layoutConstraint.secondAttribute,
+            .multiplier = layoutConstraint.multiplier,
+            .constant = layoutConstraint.constant,
+            .priority = layoutConstraint.priority,
+        };
+        MASLayoutSolverConstraint handle;
+        if ([self addConstraint:&constraint handle:&handle]) {
+            [self.handlesByLayoutConstraint setObject:@(handle) forKey:layoutConstraint];
+        }
+    }
+}
+
+- (BOOL)addConstraint:(const MASLayoutTreeConstraint *)constraint handle:(MASLayoutSolverConstraint *)handle {
+    switch (MASLayoutTreeAddConstraint(_tree, constraint, handle)) {
+        case MASLayoutSolverStatusOK:
+            return YES;
+        case MASLayoutSolverStatusUnsatisfiable:
+            self.unsatisfiableConstraintCount++;
+            return NO;
+        default:
+            self.unsupportedConstraintCount++;
+            return NO;
+    }
+}
+
+#pragma mark - layout
+
+- (void)layoutWithSize:(CGSize)size {
+    MASLayoutSolverStatus status = MASLayoutTreeSetRootSize(_tree,
+                                                            size.width < 0 ? MAS_LAYOUT_TREE_NO_METRIC : size.width,
+                                                            size.height < 0 ? MAS_LAYOUT_TREE_NO_METRIC : size.height);
+    if (status == MASLayoutSolverStatusUnsatisfiable) {
+        self.unsatisfiableConstraintCount++;
+    }
+}
+
+- (CGSize)fittingSizeForTargetSize:(CGSize)targetSize
+         horizontalFittingPriority:(MASLayoutPriority)horizontalFittingPriority
+           verticalFittingPriority:(MASLayoutPriority)verticalFittingPriority {
+    MASLayoutSolverStatus status = MASLayoutTreeSetRootSizeWithPriorities(_tree,
+                                                                          MAX(targetSize.width, 0), MAX(targetSize.height, 0),
+                                                                          horizontalFittingPriority, verticalFittingPriority);
+    if (status == MASLayoutSolverStatusUnsatisfiable) {
+        self.unsatisfiableConstraintCount++;
+    }
+    MASLayoutRect frame = MASLayoutTreeFrame(_tree, MASLayoutItemRoot);
+    return CGSizeMake(frame.width, frame.height);
+}
+
+- (void)setIntrinsicContentSize:(CGSize)size forView:(MAS_VIEW *)view {
+    NSNumber *item = [self.itemsByView objectForKey:view];
+    if (!item) return;
+
+    MASLayoutSolverStatus status = MASLayoutTreeSetIntrinsicSize(_tree, item.intValue,
+                                                                 size.width < 0 ? MAS_LAYOUT_TREE_NO_METRIC : size.width,
+                                                                 size.height < 0 ? MAS_LAYOUT_TREE_NO_METRIC : size.height);
+    if (status == MASLayoutSolverStatusUnsatisfiable) {
+        self.unsatisfiableConstraintCount++;
+    }
+}
+
+- (BOOL)updateConstantsOfConstraint:(MASConstraint *)constraint {
+    NSMutableArray *viewConstraints = [NSMutableArray array];
+    [constraint addViewConstraintsToArray:viewConstraints];
+
+    BOOL updated = YES;
+    for (MASViewConstraint *viewConstraint in viewConstraints) {
+        NSLayoutConstraint *layoutConstraint = viewConstraint.layoutConstraint;
+        NSNumber *handle = layoutConstraint ? [self.handlesByLayoutConstraint objectForKey:layoutConstraint] : nil;
+        if (!handle) {
+            updated = NO;
+            continue;
+        }
+        if (MASLayoutTreeSetConstant(_tree, handle.unsignedIntValue, viewConstraint.layoutConstant) != MASLayoutSolverStatusOK) {
+            updated = NO;
+        }
+    }
+    return updated;
+}
+
+- (CGRect)frameForView:(MAS_VIEW *)view {
+    NSNumber *item = [self.itemsByView objectForKey:view];
+    if (!item) return CGRectNull;
+
+    MASLayoutRect frame = MASLayoutTreeFrame(_tree, item.intValue);
+    return CGRectMake(frame.x, frame.y, frame.width, frame.height);
+}
+
+@end
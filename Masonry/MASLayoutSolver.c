@@ -0,0 +1,756 @@
+//
+//  MASLayoutSolver.c
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#include "MASLayoutSolver.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAS_SOLVER_EPSILON 1.0e-8
+#define MAS_SOLVER_NO_ROW UINT32_MAX
+#define MAS_SOLVER_INVALID_SYMBOL 0
+
+typedef enum {
+    MASSymbolInvalid = 0,
+    MASSymbolExternal,
+    MASSymbolSlack,
+    MASSymbolError,
+    MASSymbolDummy,
+} MASSymbolType;
+
+typedef uint32_t MASSymbol;
+
+typedef struct {
+    MASSymbol symbol;
+    double coefficient;
+} MASCell;
+
+/**
+ *  A row of the tableau, `basic = constant + sum(cells)`.
+ *  Rows are short, so cells are an unsorted array searched linearly.
+ */
+typedef struct {
+    MASSymbol basic;
+    double constant;
+    MASCell *cells;
+    uint32_t count;
+    uint32_t capacity;
+} MASRow;
+
+typedef struct {
+    MASSymbol marker;
+    MASSymbol other;
+    // coefficients of marker and other in the row the constraint was created with
+    double markerCoefficient;
+    double otherCoefficient;
+    double constant;
+    double strength;
+    bool alive;
+} MASConstraintInfo;
+
+typedef struct {
+    MASLayoutVariable variable;
+    MASLayoutSolverConstraint constraint;
+} MASEditInfo;
+
+struct MASLayoutSolver {
+    uint8_t *symbolTypes;
+    uint32_t *symbolRows;
+    uint32_t symbolCount;
+    uint32_t symbolCapacity;
+
+    MASRow *rows;
+    uint32_t rowCount;
+    uint32_t rowCapacity;
+
+    MASRow objective;
+    MASRow artificial;
+    bool hasArtificial;
+
+    MASSymbol *variableSymbols;
+    uint32_t variableCount;
+    uint32_t variableCapacity;
+
+    MASConstraintInfo *constraints;
+    uint32_t constraintCount;
+    uint32_t constraintCapacity;
+    uint32_t liveConstraintCount;
+
+    MASSymbol *infeasible;
+    uint32_t infeasibleCount;
+    uint32_t infeasibleCapacity;
+
+    MASEditInfo *edits;
+    uint32_t editCount;
+    uint32_t editCapacity;
+};
+
+// MARK: - memory
+
+// like the rest of the runtime, running out of memory is not recoverable
+static void *MASSolverRealloc(void *pointer, size_t size) {
+    void *result = realloc(pointer, size ? size : 1);
+    if (!result) abort();
+    return result;
+}
+
+#define MAS_SOLVER_RESERVE(array, count, capacity, extra) \
+    do { \
+        if ((count) + (extra) > (capacity)) { \
+            uint32_t newCapacity = (capacity) ? (capacity) * 2 : 8; \
+            while (newCapacity < (count) + (extra)) newCapacity *= 2; \
+            (array) = MASSolverRealloc((array), newCapacity * sizeof(*(array))); \
+            (capacity) = newCapacity; \
+        } \
+    } while (0)
+
+static inline bool MASNearZero(double value) {
+    return value < MAS_SOLVER_EPSILON && value > -MAS_SOLVER_EPSILON;
+}
+
+// MARK: - rows
+
+static void MASRowFree(MASRow *row) {
+    free(row->cells);
+    row->cells = NULL;
+    row->count = row->capacity = 0;
+}
+
+static MASRow MASRowCopy(const MASRow *row) {
+    MASRow copy = *row;
+    copy.capacity = row->count;
+    copy.cells = NULL;
+    if (row->count) {
+        copy.cells = MASSolverRealloc(NULL, row->count * sizeof(MASCell));
+        memcpy(copy.cells, row->cells, row->count * sizeof(MASCell));
+    }
+    return copy;
+}
+
+static inline uint32_t MASRowFind(const MASRow *row, MASSymbol symbol) {
+    for (uint32_t i = 0; i < row->count; i++) {
+        if (row->cells[i].symbol == symbol) return i;
+    }
+    return UINT32_MAX;
+}
+
+static inline double MASRowCoefficient(const MASRow *row, MASSymbol symbol) {
+    uint32_t i = MASRowFind(row, symbol);
+    return i == UINT32_MAX ? 0 : row->cells[i].coefficient;
+}
+
+static inline void MASRowRemoveAt(MASRow *row, uint32_t i) {
+    row->cells[i] = row->cells[--row->count];
+}
+
+static void MASRowRemove(MASRow *row, MASSymbol symbol) {
+    uint32_t i = MASRowFind(row, symbol);
+    if (i != UINT32_MAX) MASRowRemoveAt(row, i);
+}
+
+static void MASRowInsertSymbol(MASRow *row, MASSymbol symbol, double coefficient) {
+    uint32_t i = MASRowFind(row, symbol);
+    if (i != UINT32_MAX) {
+        double value = row->cells[i].coefficient + coefficient;
+        if (MASNearZero(value)) {
+            MASRowRemoveAt(row, i);
+        } else {
+            row->cells[i].coefficient = value;
+        }
+        return;
+    }
+    if (MASNearZero(coefficient)) return;
+    MAS_SOLVER_RESERVE(row->cells, row->count, row->capacity, 1);
+    row->cells[row->count++] = (MASCell){ symbol, coefficient };
+}
+
+static void MASRowInsertRow(MASRow *row, const MASRow *other, double coefficient) {
+    row->constant += other->constant * coefficient;
+    for (uint32_t i = 0; i < other->count; i++) {
+        MASRowInsertSymbol(row, other->cells[i].symbol, other->cells[i].coefficient * coefficient);
+    }
+}
+
+static void MASRowReverseSign(MASRow *row) {
+    row->constant = -row->constant;
+    for (uint32_t i = 0; i < row->count; i++) {
+        row->cells[i].coefficient = -row->cells[i].coefficient;
+    }
+}
+
+// solves `0 = constant + sum(cells)` for symbol, which must be in the row
+static void MASRowSolveFor(MASRow *row, MASSymbol symbol) {
+    uint32_t i = MASRowFind(row, symbol);
+    double coefficient = -1.0 / row->cells[i].coefficient;
+    MASRowRemoveAt(row, i);
+    row->constant *= coefficient;
+    for (uint32_t j = 0; j < row->count; j++) {
+        row->cells[j].coefficient *= coefficient;
+    }
+    row->basic = symbol;
+}
+
+// solves `lhs = constant + sum(cells)` for rhs
+static void MASRowSolveForSymbols(MASRow *row, MASSymbol lhs, MASSymbol rhs) {
+    MASRowInsertSymbol(row, lhs, -1.0);
+    MASRowSolveFor(row, rhs);
+}
+
+static void MASRowSubstitute(MASRow *row, MASSymbol symbol, const MASRow *replacement) {
+    uint32_t i = MASRowFind(row, symbol);
+    if (i == UINT32_MAX) return;
+    double coefficient = row->cells[i].coefficient;
+    MASRowRemoveAt(row, i);
+    MASRowInsertRow(row, replacement, coefficient);
+}
+
+// MARK: - symbols and tableau
+
+static MASSymbol MASSolverNewSymbol(MASLayoutSolver *solver, MASSymbolType type) {
+    if (solver->symbolCount == solver->symbolCapacity) {
+        solver->symbolCapacity = solver->symbolCapacity ? solver->symbolCapacity * 2 : 64;
+        solver->symbolTypes = MASSolverRealloc(solver->symbolTypes, solver->symbolCapacity * sizeof(uint8_t));
+        solver->symbolRows = MASSolverRealloc(solver->symbolRows, solver->symbolCapacity * sizeof(uint32_t));
+    }
+    MASSymbol symbol = solver->symbolCount++;
+    solver->symbolTypes[symbol] = (uint8_t)type;
+    solver->symbolRows[symbol] = MAS_SOLVER_NO_ROW;
+    return symbol;
+}
+
+static inline MASSymbolType MASSolverSymbolType(const MASLayoutSolver *solver, MASSymbol symbol) {
+    return (MASSymbolType)solver->symbolTypes[symbol];
+}
+
+static inline MASRow *MASSolverRowForSymbol(const MASLayoutSolver *solver, MASSymbol symbol) {
+    uint32_t index = solver->symbolRows[symbol];
+    return index == MAS_SOLVER_NO_ROW ? NULL : &solver->rows[index];
+}
+
+// moves a row into the tableau, the tableau takes ownership of its cells
+static void MASSolverInsertRow(MASLayoutSolver *solver, MASRow row) {
+    MAS_SOLVER_RESERVE(solver->rows, solver->rowCount, solver->rowCapacity, 1);
+    solver->symbolRows[row.basic] = solver->rowCount;
+    solver->rows[solver->rowCount++] = row;
+}
+
+// moves a row out of the tableau, the caller takes ownership of its cells
+static MASRow MASSolverTakeRow(MASLayoutSolver *solver, MASSymbol basic) {
+    uint32_t index = solver->symbolRows[basic];
+    MASRow row = solver->rows[index];
+    solver->symbolRows[basic] = MAS_SOLVER_NO_ROW;
+    if (index != --solver->rowCount) {
+        solver->rows[index] = solver->rows[solver->rowCount];
+        solver->symbolRows[solver->rows[index].basic] = index;
+    }
+    return row;
+}
+
+static void MASSolverMarkInfeasible(MASLayoutSolver *solver, MASSymbol symbol) {
+    MAS_SOLVER_RESERVE(solver->infeasible, solver->infeasibleCount, solver->infeasibleCapacity, 1);
+    solver->infeasible[solver->infeasibleCount++] = symbol;
+}
+
+// replaces symbol with row in every row of the tableau and the objectives
+static void MASSolverSubstitute(MASLayoutSolver *solver, MASSymbol symbol, const MASRow *row) {
+    for (uint32_t i = 0; i < solver->rowCount; i++) {
+        MASRow *current = &solver->rows[i];
+        MASRowSubstitute(current, symbol, row);
+        if (MASSolverSymbolType(solver, current->basic) != MASSymbolExternal && current->constant < 0.0) {
+            MASSolverMarkInfeasible(solver, current->basic);
+        }
+    }
+    MASRowSubstitute(&solver->objective, symbol, row);
+    if (solver->hasArtificial) {
+        MASRowSubstitute(&solver->artificial, symbol, row);
+    }
+}
+
+// swaps the basic symbol of a row with one of its parametric symbols
+static void MASSolverPivot(MASLayoutSolver *solver, MASSymbol leaving, MASSymbol entering) {
+    MASRow row = MASSolverTakeRow(solver, leaving);
+    MASRowSolveForSymbols(&row, leaving, entering);
+    MASSolverSubstitute(solver, entering, &row);
+    MASSolverInsertRow(solver, row);
+}
+
+// MARK: - simplex
+
+// the lowest numbered symbol that improves the objective, which prevents cycling
+static MASSymbol MASSolverEnteringSymbol(const MASLayoutSolver *solver, const MASRow *objective) {
+    MASSymbol entering = MAS_SOLVER_INVALID_SYMBOL;
+    for (uint32_t i = 0; i < objective->count; i++) {
+        const MASCell *cell = &objective->cells[i];
+        if (cell->coefficient < 0.0 && MASSolverSymbolType(solver, cell->symbol) != MASSymbolDummy
+            && (entering == MAS_SOLVER_INVALID_SYMBOL || cell->symbol < entering)) {
+            entering = cell->symbol;
+        }
+    }
+    return entering;
+}
+
+static MASSymbol MASSolverLeavingSymbol(const MASLayoutSolver *solver, MASSymbol entering) {
+    double ratio = INFINITY;
+    MASSymbol leaving = MAS_SOLVER_INVALID_SYMBOL;
+    for (uint32_t i = 0; i < solver->rowCount; i++) {
+        const MASRow *row = &solver->rows[i];
+        if (MASSolverSymbolType(solver, row->basic) == MASSymbolExternal) continue;
+        double coefficient = MASRowCoefficient(row, entering);
+        if (coefficient >= 0.0) continue;
+        double r = -row->constant / coefficient;
+        if (r < ratio || (r == ratio && row->basic < leaving)) {
+            ratio = r;
+            leaving = row->basic;
+        }
+    }
+    return leaving;
+}
+
+static MASLayoutSolverStatus MASSolverOptimize(MASLayoutSolver *solver, MASRow *objective) {
+    for (;;) {
+        MASSymbol entering = MASSolverEnteringSymbol(solver, objective);
+        if (entering == MAS_SOLVER_INVALID_SYMBOL) return MASLayoutSolverStatusOK;
+
+        MASSymbol leaving = MASSolverLeavingSymbol(solver, entering);
+        if (leaving == MAS_SOLVER_INVALID_SYMBOL) return MASLayoutSolverStatusInternalError;
+
+        MASSolverPivot(solver, leaving, entering);
+    }
+}
+
+static MASSymbol MASSolverDualEnteringSymbol(const MASLayoutSolver *solver, const MASRow *row) {
+    double ratio = INFINITY;
+    MASSymbol entering = MAS_SOLVER_INVALID_SYMBOL;
+    for (uint32_t i = 0; i < row->count; i++) {
+        const MASCell *cell = &row->cells[i];
+        if (cell->coefficient <= 0.0 || MASSolverSymbolType(solver, cell->symbol) == MASSymbolDummy) continue;
+        double r = MASRowCoefficient(&solver->objective, cell->symbol) / cell->coefficient;
+        if (r < ratio || (r == ratio && cell->symbol < entering)) {
+            ratio = r;
+            entering = cell->symbol;
+        }
+    }
+    return entering;
+}
+
+// restores feasibility of the rows marked infeasible while keeping the solution optimal
+static MASLayoutSolverStatus MASSolverDualOptimize(MASLayoutSolver *solver) {
+    while (solver->infeasibleCount) {
+        MASSymbol leaving = solver->infeasible[--solver->infeasibleCount];
+        MASRow *row = MASSolverRowForSymbol(solver, leaving);
+        if (!row || row->constant >= 0.0) continue;
+
+        MASSymbol entering = MASSolverDualEnteringSymbol(solver, row);
+        if (entering == MAS_SOLVER_INVALID_SYMBOL) {
+            solver->infeasibleCount = 0;
+            return MASLayoutSolverStatusInternalError;
+        }
+        MASSolverPivot(solver, leaving, entering);
+    }
+    return MASLayoutSolverStatusOK;
+}
+
+// MARK: - constraints
+
+static MASRow MASSolverCreateRow(MASLayoutSolver *solver, const MASLayoutSolverTerm *terms, size_t termCount,
+                                 double constant, MASLayoutSolverRelation relation, double strength,
+                                 MASConstraintInfo *info) {
+    MASRow row = { MAS_SOLVER_INVALID_SYMBOL, constant, NULL, 0, 0 };
+
+    // substitute the variables that are already basic
+    for (size_t i = 0; i < termCount; i++) {
+        if (MASNearZero(terms[i].coefficient)) continue;
+        MASSymbol symbol = solver->variableSymbols[terms[i].variable];
+        MASRow *basicRow = MASSolverRowForSymbol(solver, symbol);
+        if (basicRow) {
+            MASRowInsertRow(&row, basicRow, terms[i].coefficient);
+        } else {
+            MASRowInsertSymbol(&row, symbol, terms[i].coefficient);
+        }
+    }
+
+    bool required = strength >= MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED;
+    info->marker = info->other = MAS_SOLVER_INVALID_SYMBOL;
+    info->markerCoefficient = info->otherCoefficient = 0.0;
+    info->constant = constant;
+    info->strength = strength;
+    if (relation != MASLayoutSolverRelationEqual) {
+        double coefficient = relation == MASLayoutSolverRelationLessThanOrEqual ? 1.0 : -1.0;
+        MASSymbol slack = MASSolverNewSymbol(solver, MASSymbolSlack);
+        info->marker = slack;
+        info->markerCoefficient = coefficient;
+        MASRowInsertSymbol(&row, slack, coefficient);
+        if (!required) {
+            MASSymbol error = MASSolverNewSymbol(solver, MASSymbolError);
+            info->other = error;
+            info->otherCoefficient = -coefficient;
+            MASRowInsertSymbol(&row, error, -coefficient);
+            MASRowInsertSymbol(&solver->objective, error, strength);
+        }
+    } else if (!required) {
+        MASSymbol errorPlus = MASSolverNewSymbol(solver, MASSymbolError);
+        MASSymbol errorMinus = MASSolverNewSymbol(solver, MASSymbolError);
+        info->marker = errorPlus;
+        info->other = errorMinus;
+        info->markerCoefficient = -1.0;
+        info->otherCoefficient = 1.0;
+        MASRowInsertSymbol(&row, errorPlus, -1.0);
+        MASRowInsertSymbol(&row, errorMinus, 1.0);
+        MASRowInsertSymbol(&solver->objective, errorPlus, strength);
+        MASRowInsertSymbol(&solver->objective, errorMinus, strength);
+    } else {
+        MASSymbol dummy = MASSolverNewSymbol(solver, MASSymbolDummy);
+        info->marker = dummy;
+        info->markerCoefficient = 1.0;
+        MASRowInsertSymbol(&row, dummy, 1.0);
+    }
+
+    if (row.constant < 0.0) {
+        MASRowReverseSign(&row);
+    }
+    return row;
+}
+
+static MASSymbol MASSolverChooseSubject(const MASLayoutSolver *solver, const MASRow *row, const MASConstraintInfo *info) {
+    for (uint32_t i = 0; i < row->count; i++) {
+        if (MASSolverSymbolType(solver, row->cells[i].symbol) == MASSymbolExternal) return row->cells[i].symbol;
+    }
+    MASSymbol candidates[2] = { info->marker, info->other };
+    for (int i = 0; i < 2; i++) {
+        MASSymbolType type = MASSolverSymbolType(solver, candidates[i]);
+        if ((type == MASSymbolSlack || type == MASSymbolError) && MASRowCoefficient(row, candidates[i]) < 0.0) {
+            return candidates[i];
+        }
+    }
+    return MAS_SOLVER_INVALID_SYMBOL;
+}
+
+static bool MASSolverAllDummies(const MASLayoutSolver *solver, const MASRow *row) {
+    for (uint32_t i = 0; i < row->count; i++) {
+        if (MASSolverSymbolType(solver, row->cells[i].symbol) != MASSymbolDummy) return false;
+    }
+    return true;
+}
+
+static MASSymbol MASSolverAnyPivotableSymbol(const MASLayoutSolver *solver, const MASRow *row) {
+    for (uint32_t i = 0; i < row->count; i++) {
+        MASSymbolType type = MASSolverSymbolType(solver, row->cells[i].symbol);
+        if (type == MASSymbolSlack || type == MASSymbolError) return row->cells[i].symbol;
+    }
+    return MAS_SOLVER_INVALID_SYMBOL;
+}
+
+// finds a feasible basic variable for a row without an obvious subject, consumes the row
+static bool MASSolverAddWithArtificialVariable(MASLayoutSolver *solver, MASRow row) {
+    MASSymbol artificialSymbol = MASSolverNewSymbol(solver, MASSymbolSlack);
+    row.basic = artificialSymbol;
+    solver->artificial = MASRowCopy(&row);
+    solver->hasArtificial = true;
+    MASSolverInsertRow(solver, row);
+
+    MASSolverOptimize(solver, &solver->artificial);
+    bool success = MASNearZero(solver->artificial.constant);
+    MASRowFree(&solver->artificial);
+    solver->hasArtificial = false;
+
+    if (MASSolverRowForSymbol(solver, artificialSymbol)) {
+        MASRow artificialRow = MASSolverTakeRow(solver, artificialSymbol);
+        if (artificialRow.count == 0) {
+            MASRowFree(&artificialRow);
+            return success;
+        }
+        MASSymbol entering = MASSolverAnyPivotableSymbol(solver, &artificialRow);
+        if (entering == MAS_SOLVER_INVALID_SYMBOL) {
+            MASRowFree(&artificialRow);
+            return false;
+        }
+        MASRowSolveForSymbols(&artificialRow, artificialSymbol, entering);
+        MASSolverSubstitute(solver, entering, &artificialRow);
+        MASSolverInsertRow(solver, artificialRow);
+    }
+
+    for (uint32_t i = 0; i < solver->rowCount; i++) {
+        MASRowRemove(&solver->rows[i], artificialSymbol);
+    }
+    MASRowRemove(&solver->objective, artificialSymbol);
+    return success;
+}
+
+static void MASSolverRemoveMarkerEffects(MASLayoutSolver *solver, MASSymbol marker, double strength) {
+    if (marker == MAS_SOLVER_INVALID_SYMBOL || MASSolverSymbolType(solver, marker) != MASSymbolError) return;
+    MASRow *row = MASSolverRowForSymbol(solver, marker);
+    if (row) {
+        MASRowInsertRow(&solver->objective, row, -strength);
+    } else {
+        MASRowInsertSymbol(&solver->objective, marker, -strength);
+    }
+}
+
+// the row to pivot a marker into so it becomes basic and can be dropped
+static MASSymbol MASSolverMarkerLeavingSymbol(const MASLayoutSolver *solver, MASSymbol marker) {
+    double ratio1 = INFINITY, ratio2 = INFINITY;
+    MASSymbol first = MAS_SOLVER_INVALID_SYMBOL, second = MAS_SOLVER_INVALID_SYMBOL, third = MAS_SOLVER_INVALID_SYMBOL;
+    for (uint32_t i = 0; i < solver->rowCount; i++) {
+        const MASRow *row = &solver->rows[i];
+        double coefficient = MASRowCoefficient(row, marker);
+        if (coefficient == 0.0) continue;
+        if (MASSolverSymbolType(solver, row->basic) == MASSymbolExternal) {
+            third = row->basic;
+        } else if (coefficient < 0.0) {
+            double r = -row->constant / coefficient;
+            if (r < ratio1) {
+                ratio1 = r;
+                first = row->basic;
+            }
+        } else {
+            double r = row->constant / coefficient;
+            if (r < ratio2) {
+                ratio2 = r;
+                second = row->basic;
+            }
+        }
+    }
+    if (first != MAS_SOLVER_INVALID_SYMBOL) return first;
+    if (second != MAS_SOLVER_INVALID_SYMBOL) return second;
+    return third;
+}
+
+static MASLayoutSolverStatus MASSolverRemoveInfo(MASLayoutSolver *solver, const MASConstraintInfo *info) {
+    MASSolverRemoveMarkerEffects(solver, info->marker, info->strength);
+    MASSolverRemoveMarkerEffects(solver, info->other, info->strength);
+
+    if (MASSolverRowForSymbol(solver, info->marker)) {
+        MASRow row = MASSolverTakeRow(solver, info->marker);
+        MASRowFree(&row);
+    } else {
+        MASSymbol leaving = MASSolverMarkerLeavingSymbol(solver, info->marker);
+        if (leaving == MAS_SOLVER_INVALID_SYMBOL) return MASLayoutSolverStatusInternalError;
+
+        MASRow row = MASSolverTakeRow(solver, leaving);
+        MASRowSolveForSymbols(&row, leaving, info->marker);
+        MASSolverSubstitute(solver, info->marker, &row);
+        MASRowFree(&row);
+    }
+
+    MASLayoutSolverStatus status = MASSolverOptimize(solver, &solver->objective);
+    solver->infeasibleCount = 0;
+    return status;
+}
+
+// MARK: - constants
+
+/**
+ *  Changing the constant of `expression + constant + a * marker = 0` by delta is the same as
+ *  substituting marker with `marker + delta / a`, so only the constants of rows change.
+ *  The previous solution stays optimal and the dual simplex restores feasibility in a few pivots.
+ */
+static void MASSolverShiftConstant(MASLayoutSolver *solver, const MASConstraintInfo *info, double delta) {
+    MASRow *row = MASSolverRowForSymbol(solver, info->marker);
+    if (row) {
+        row->constant -= delta / info->markerCoefficient;
+        if (row->constant < 0.0) MASSolverMarkInfeasible(solver, info->marker);
+        return;
+    }
+    row = info->other != MAS_SOLVER_INVALID_SYMBOL ? MASSolverRowForSymbol(solver, info->other) : NULL;
+    if (row) {
+        row->constant -= delta / info->otherCoefficient;
+        if (row->constant < 0.0) MASSolverMarkInfeasible(solver, info->other);
+        return;
+    }
+    for (uint32_t i = 0; i < solver->rowCount; i++) {
+        row = &solver->rows[i];
+        double coefficient = MASRowCoefficient(row, info->marker);
+        if (coefficient == 0.0) continue;
+        row->constant += coefficient * delta / info->markerCoefficient;
+        if (row->constant < 0.0 && MASSolverSymbolType(solver, row->basic) != MASSymbolExternal) {
+            MASSolverMarkInfeasible(solver, row->basic);
+        }
+    }
+}
+
+static void MASSolverMarkAllInfeasible(MASLayoutSolver *solver) {
+    solver->infeasibleCount = 0;
+    for (uint32_t i = 0; i < solver->rowCount; i++) {
+        const MASRow *row = &solver->rows[i];
+        if (row->constant < 0.0 && MASSolverSymbolType(solver, row->basic) != MASSymbolExternal) {
+            MASSolverMarkInfeasible(solver, row->basic);
+        }
+    }
+}
+
+static MASEditInfo *MASSolverEditInfo(const MASLayoutSolver *solver, MASLayoutVariable variable) {
+    for (uint32_t i = 0; i < solver->editCount; i++) {
+        if (solver->edits[i].variable == variable) return &solver->edits[i];
+    }
+    return NULL;
+}
+
+// MARK: - public
+
+double MASLayoutSolverStrengthForPriority(double priority) {
+    if (priority >= 1000.0) return MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED;
+    if (priority < 1.0) priority = 1.0;
+    return pow(10.0, priority / 200.0);
+}
+
+MASLayoutSolver *MASLayoutSolverCreate(void) {
+    MASLayoutSolver *solver = MASSolverRealloc(NULL, sizeof(MASLayoutSolver));
+    memset(solver, 0, sizeof(MASLayoutSolver));
+    // symbol 0 is reserved as the invalid symbol
+    MASSolverNewSymbol(solver, MASSymbolInvalid);
+    return solver;
+}
+
+void MASLayoutSolverDestroy(MASLayoutSolver *solver) {
+    if (!solver) return;
+    for (uint32_t i = 0; i < solver->rowCount; i++) {
+        MASRowFree(&solver->rows[i]);
+    }
+    MASRowFree(&solver->objective);
+    MASRowFree(&solver->artificial);
+    free(solver->rows);
+    free(solver->symbolTypes);
+    free(solver->symbolRows);
+    free(solver->variableSymbols);
+    free(solver->constraints);
+    free(solver->infeasible);
+    free(solver->edits);
+    free(solver);
+}
+
+MASLayoutVariable MASLayoutSolverAddVariable(MASLayoutSolver *solver) {
+    MAS_SOLVER_RESERVE(solver->variableSymbols, solver->variableCount, solver->variableCapacity, 1);
+    solver->variableSymbols[solver->variableCount] = MASSolverNewSymbol(solver, MASSymbolExternal);
+    return solver->variableCount++;
+}
+
+MASLayoutSolverStatus MASLayoutSolverAddConstraint(MASLayoutSolver *solver,
+                                                   const MASLayoutSolverTerm *terms, size_t termCount,
+                                                   double constant, MASLayoutSolverRelation relation, double strength,
+                                                   MASLayoutSolverConstraint *constraint) {
+    if (constraint) *constraint = MASLayoutSolverConstraintInvalid;
+    for (size_t i = 0; i < termCount; i++) {
+        if (terms[i].variable >= solver->variableCount) return MASLayoutSolverStatusInvalidHandle;
+    }
+    if (!(strength > 0.0)) return MASLayoutSolverStatusUnsupported;
+
+    MASConstraintInfo info;
+    MASRow row = MASSolverCreateRow(solver, terms, termCount, constant, relation, strength, &info);
+    info.alive = true;
+
+    MASSymbol subject = MASSolverChooseSubject(solver, &row, &info);
+    if (subject == MAS_SOLVER_INVALID_SYMBOL && MASSolverAllDummies(solver, &row)) {
+        if (!MASNearZero(row.constant)) {
+            // only required equalities consist of dummies, nothing was added to the objective
+            MASRowFree(&row);
+            return MASLayoutSolverStatusUnsatisfiable;
+        }
+        subject = info.marker;
+    }
+
+    if (subject == MAS_SOLVER_INVALID_SYMBOL) {
+        if (!MASSolverAddWithArtificialVariable(solver, row)) {
+            // the row is in the tableau, take it out again so a failed add leaves no trace
+            MASSolverRemoveInfo(solver, &info);
+            return MASLayoutSolverStatusUnsatisfiable;
+        }
+    } else {
+        MASRowSolveFor(&row, subject);
+        MASSolverSubstitute(solver, subject, &row);
+        MASSolverInsertRow(solver, row);
+    }
+
+    MASLayoutSolverStatus status = MASSolverOptimize(solver, &solver->objective);
+    solver->infeasibleCount = 0;
+    if (status != MASLayoutSolverStatusOK) return status;
+
+    MAS_SOLVER_RESERVE(solver->constraints, solver->constraintCount, solver->constraintCapacity, 1);
+    solver->constraints[solver->constraintCount] = info;
+    if (constraint) *constraint = solver->constraintCount;
+    solver->constraintCount++;
+    solver->liveConstraintCount++;
+    return MASLayoutSolverStatusOK;
+}
+
+MASLayoutSolverStatus MASLayoutSolverRemoveConstraint(MASLayoutSolver *solver, MASLayoutSolverConstraint constraint) {
+    if (constraint >= solver->constraintCount || !solver->constraints[constraint].alive) {
+        return MASLayoutSolverStatusInvalidHandle;
+    }
+    MASConstraintInfo *info = &solver->constraints[constraint];
+    info->alive = false;
+    solver->liveConstraintCount--;
+    return MASSolverRemoveInfo(solver, info);
+}
+
+double MASLayoutSolverValue(const MASLayoutSolver *solver, MASLayoutVariable variable) {
+    if (variable >= solver->variableCount) return 0.0;
+    MASRow *row = MASSolverRowForSymbol(solver, solver->variableSymbols[variable]);
+    return row ? row->constant : 0.0;
+}
+
+size_t MASLayoutSolverConstraintCount(const MASLayoutSolver *solver) {
+    return solver->liveConstraintCount;
+}
+
+MASLayoutSolverStatus MASLayoutSolverSetConstant(MASLayoutSolver *solver, MASLayoutSolverConstraint constraint, double constant) {
+    if (constraint >= solver->constraintCount || !solver->constraints[constraint].alive) {
+        return MASLayoutSolverStatusInvalidHandle;
+    }
+    MASConstraintInfo *info = &solver->constraints[constraint];
+    double delta = constant - info->constant;
+    if (delta == 0.0) return MASLayoutSolverStatusOK;
+
+    info->constant = constant;
+    MASSolverShiftConstant(solver, info, delta);
+    if (MASSolverDualOptimize(solver) == MASLayoutSolverStatusOK) return MASLayoutSolverStatusOK;
+
+    // a required constraint can't move there, pivots preserve the system so shifting back restores it
+    info->constant -= delta;
+    MASSolverShiftConstant(solver, info, -delta);
+    MASSolverMarkAllInfeasible(solver);
+    MASSolverDualOptimize(solver);
+    return MASLayoutSolverStatusUnsatisfiable;
+}
+
+double MASLayoutSolverConstant(const MASLayoutSolver *solver, MASLayoutSolverConstraint constraint) {
+    if (constraint >= solver->constraintCount || !solver->constraints[constraint].alive) return 0.0;
+    return solver->constraints[constraint].constant;
+}
+
+MASLayoutSolverStatus MASLayoutSolverAddEditVariable(MASLayoutSolver *solver, MASLayoutVariable variable, double strength) {
+    if (variable >= solver->variableCount) return MASLayoutSolverStatusInvalidHandle;
+    if (MASSolverEditInfo(solver, variable)) return MASLayoutSolverStatusOK;
+    // an edit that must be satisfied could make suggestions unsatisfiable
+    if (!(strength < MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED)) strength = MASLayoutSolverStrengthForPriority(999);
+
+    // variable == its current value, suggestions move the constant
+    MASLayoutSolverTerm term = { variable, 1.0 };
+    MASEditInfo edit = { variable, MASLayoutSolverConstraintInvalid };
+    MASLayoutSolverStatus status = MASLayoutSolverAddConstraint(solver, &term, 1, -MASLayoutSolverValue(solver, variable),
+                                                                MASLayoutSolverRelationEqual, strength, &edit.constraint);
+    if (status != MASLayoutSolverStatusOK) return status;
+
+    MAS_SOLVER_RESERVE(solver->edits, solver->editCount, solver->editCapacity, 1);
+    solver->edits[solver->editCount++] = edit;
+    return MASLayoutSolverStatusOK;
+}
+
+MASLayoutSolverStatus MASLayoutSolverRemoveEditVariable(MASLayoutSolver *solver, MASLayoutVariable variable) {
+    MASEditInfo *edit = MASSolverEditInfo(solver, variable);
+    if (!edit) return MASLayoutSolverStatusInvalidHandle;
+    MASLayoutSolverConstraint constraint = edit->constraint;
+    *edit = solver->edits[--solver->editCount];
+    return MASLayoutSolverRemoveConstraint(solver, constraint);
+}
+
+MASLayoutSolverStatus MASLayoutSolverSuggestValue(MASLayoutSolver *solver, MASLayoutVariable variable, double value) {
+    MASEditInfo *edit = MASSolverEditInfo(solver, variable);
+    if (!edit) return MASLayoutSolverStatusInvalidHandle;
+    return MASLayoutSolverSetConstant(solver, edit->constraint, -value);
+}
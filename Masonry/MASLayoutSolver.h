@@ -0,0 +1,150 @@
+//
+//  MASLayoutSolver.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#ifndef MASLayoutSolver_h
+#define MASLayoutSolver_h
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  An incremental simplex solver for linear equalities and inequalities with priorities,
+ *  using the Cassowary algorithm the Auto Layout engine is built on.
+ *
+ *  Plain C99 without Foundation, so it builds and runs wherever a C compiler does.
+ *  A solver is not thread safe, but separate solvers can be used concurrently.
+ */
+typedef struct MASLayoutSolver MASLayoutSolver;
+
+/**
+ *  Handle of a variable, valid for the lifetime of its solver
+ */
+typedef uint32_t MASLayoutVariable;
+
+/**
+ *  Handle of a constraint, valid until the constraint is removed
+ */
+typedef uint32_t MASLayoutSolverConstraint;
+
+static const MASLayoutSolverConstraint MASLayoutSolverConstraintInvalid = UINT32_MAX;
+
+/**
+ *  Relation of a constraint expression to zero, raw values match NSLayoutRelation
+ */
+typedef enum {
+    MASLayoutSolverRelationLessThanOrEqual = -1,
+    MASLayoutSolverRelationEqual = 0,
+    MASLayoutSolverRelationGreaterThanOrEqual = 1,
+} MASLayoutSolverRelation;
+
+typedef enum {
+    MASLayoutSolverStatusOK = 0,
+    /** a required constraint conflicts with other required constraints, the solver is left unchanged */
+    MASLayoutSolverStatusUnsatisfiable,
+    /** the constraint or variable handle is unknown */
+    MASLayoutSolverStatusInvalidHandle,
+    /** the constraint uses a feature the receiver can not express */
+    MASLayoutSolverStatusUnsupported,
+    /** the tableau became inconsistent, which only happens with degenerate floating point input */
+    MASLayoutSolverStatusInternalError,
+} MASLayoutSolverStatus;
+
+/**
+ *  Strength of constraints that must be satisfied
+ */
+#define MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED ((double)INFINITY)
+
+/**
+ *  A variable multiplied by a coefficient
+ */
+typedef struct {
+    MASLayoutVariable variable;
+    double coefficient;
+} MASLayoutSolverTerm;
+
+/**
+ *	Converts a layout priority to a strength.
+ *  Priorities below required weigh exponentially, so a constraint outweighs many constraints
+ *  a few hundred priority levels below it, approximating the strict ordering of the Auto Layout engine.
+ *
+ *	@param	priority	a MASLayoutPriority between 1 and 1000
+ *
+ *	@return	MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED for priority 1000, otherwise a finite positive weight
+ */
+double MASLayoutSolverStrengthForPriority(double priority);
+
+MASLayoutSolver *MASLayoutSolverCreate(void);
+void MASLayoutSolverDestroy(MASLayoutSolver *solver);
+
+/**
+ *	Creates an unconstrained variable with value 0
+ */
+MASLayoutVariable MASLayoutSolverAddVariable(MASLayoutSolver *solver);
+
+/**
+ *	Adds the constraint `sum(terms) + constant <relation> 0`
+ *
+ *	@param	terms	the variables and coefficients of the expression, a variable may appear more than once
+ *	@param	strength	MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED or a positive weight, see MASLayoutSolverStrengthForPriority
+ *	@param	constraint	set to the handle of the new constraint, may be NULL
+ *
+ *	@return	MASLayoutSolverStatusOK, or MASLayoutSolverStatusUnsatisfiable for a conflicting required constraint
+ */
+MASLayoutSolverStatus MASLayoutSolverAddConstraint(MASLayoutSolver *solver,
+                                                   const MASLayoutSolverTerm *terms, size_t termCount,
+                                                   double constant, MASLayoutSolverRelation relation, double strength,
+                                                   MASLayoutSolverConstraint *constraint);
+
+MASLayoutSolverStatus MASLayoutSolverRemoveConstraint(MASLayoutSolver *solver, MASLayoutSolverConstraint constraint);
+
+/**
+ *	Changes the constant of a constraint in place.
+ *  The solver re-optimizes from the previous solution instead of removing and adding the constraint,
+ *  which makes animating constants every frame cheap.
+ *
+ *	@return	MASLayoutSolverStatusUnsatisfiable if the change conflicts with required constraints, the constant is then unchanged
+ */
+MASLayoutSolverStatus MASLayoutSolverSetConstant(MASLayoutSolver *solver, MASLayoutSolverConstraint constraint, double constant);
+
+double MASLayoutSolverConstant(const MASLayoutSolver *solver, MASLayoutSolverConstraint constraint);
+
+/**
+ *	Marks a variable as edited, so values can be suggested for it with MASLayoutSolverSuggestValue.
+ *  The variable keeps its current value until the first suggestion.
+ *
+ *	@param	strength	how strongly suggestions are followed, required strengths are lowered to priority 999
+ */
+MASLayoutSolverStatus MASLayoutSolverAddEditVariable(MASLayoutSolver *solver, MASLayoutVariable variable, double strength);
+
+MASLayoutSolverStatus MASLayoutSolverRemoveEditVariable(MASLayoutSolver *solver, MASLayoutVariable variable);
+
+/**
+ *	Moves an edited variable as close to value as its constraints allow, incrementally from the previous solution
+ */
+MASLayoutSolverStatus MASLayoutSolverSuggestValue(MASLayoutSolver *solver, MASLayoutVariable variable, double value);
+
+/**
+ *	Returns the value of a variable in the current solution
+ */
+double MASLayoutSolverValue(const MASLayoutSolver *solver, MASLayoutVariable variable);
+
+/**
+ *  Number of live constraints
+ */
+size_t MASLayoutSolverConstraintCount(const MASLayoutSolver *solver);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
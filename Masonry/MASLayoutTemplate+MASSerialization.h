@@ -0,0 +1,59 @@
+//
+//  MASLayoutTemplate+MASSerialization.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASLayoutTemplate.h"
+
+/**
+ *	The version of the binary format written by dataRepresentation, newer versions are rejected when loading
+ */
+static const uint16_t MASLayoutTemplateFormatVersion = 1;
+
+extern NSString *const MASLayoutTemplateErrorDomain;
+
+typedef NS_ENUM(NSInteger, MASLayoutTemplateError) {
+    MASLayoutTemplateErrorCorruptData = 1,
+    MASLayoutTemplateErrorUnsupportedVersion,
+    MASLayoutTemplateErrorUnsupportedKey,
+};
+
+/**
+ *  A compact, versioned binary format for layout templates so precompiled layouts can ship with an app or a server response.
+ *
+ *  The data starts with the magic bytes "MASL", the format version, the slot and entry counts,
+ *  followed by fixed size little endian entries holding the slots, items, attributes, relation,
+ *  multiplier, constant, priority and key of each constraint, and a table of the UTF-8 encoded keys and tokens.
+ *  Loading decodes the entries in a single pass over the bytes, the resulting template installs its constraints
+ *  straight from the entries without executing any maker blocks.
+ */
+@interface MASLayoutTemplate (MASSerialization)
+
+/**
+ *	The template encoded in the binary format, nil if a key or token is not a string
+ */
+@property (nonatomic, copy, readonly) NSData *dataRepresentation;
+
+/**
+ *	Writes the binary format to a file
+ */
+- (BOOL)writeToFile:(NSString *)path error:(NSError **)error;
+
+/**
+ *	Decodes a template from data in the binary format
+ *
+ *	@return	a new template, or nil if the data is corrupt or of a newer version
+ */
++ (instancetype)templateWithData:(NSData *)data error:(NSError **)error;
+
+/**
+ *	Memory maps a file in the binary format and decodes a template from it
+ *
+ *	@return	a new template, or nil if the file could not be read, is corrupt or of a newer version
+ */
++ (instancetype)templateWithContentsOfFile:(NSString *)path error:(NSError **)error;
+
+@end
@@ -0,0 +1,368 @@
+//
+//  MASLayoutTemplate+MASSerialization.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASLayoutTemplate+MASSerialization.h"
+
+NSString *const MASLayoutTemplateErrorDomain = @"MASLayoutTemplateErrorDomain";
+
+static const char MASLayoutTemplateMagic[4] = { 'M', 'A', 'S', 'L' };
+static const uint32_t MASLayoutTemplateNoString = UINT32_MAX;
+// slots without tokens take no space in the data, this bounds what a corrupt slot count can allocate
+static const uint32_t MASLayoutTemplateMaximumSlotCount = 1 << 16;
+
+typedef NS_OPTIONS(uint16_t, MASLayoutTemplateFlags) {
+    MASLayoutTemplateFlagsHasKeys = 1 << 0,
+    MASLayoutTemplateFlagsHasTokens = 1 << 1,
+};
+
+// magic, version, flags, slot count, entry count, string count, reserved
+static const NSUInteger MASLayoutTemplateHeaderSize = 4 + 2 + 2 + 4 + 4 + 4 + 4;
+// slots, attributes, relation, items, reserved, key, multiplier, constant, priority, reserved
+static const NSUInteger MASLayoutTemplateEntrySize = 4 + 4 + 4 + 4 + 1 + 1 + 1 + 1 + 4 + 8 + 8 + 4 + 4;
+
+#pragma mark - Writing
+
+static void MASLayoutTemplateAppend8(NSMutableData *data, uint8_t value) {
+    [data appendBytes:&value length:sizeof(value)];
+}
+
+static void MASLayoutTemplateAppend16(NSMutableData *data, uint16_t value) {
+    value = CFSwapInt16HostToLittle(value);
+    [data appendBytes:&value length:sizeof(value)];
+}
+
+static void MASLayoutTemplateAppend32(NSMutableData *data, uint32_t value) {
+    value = CFSwapInt32HostToLittle(value);
+    [data appendBytes:&value length:sizeof(value)];
+}
+
+static void MASLayoutTemplateAppend64(NSMutableData *data, uint64_t value) {
+    value = CFSwapInt64HostToLittle(value);
+    [data appendBytes:&value length:sizeof(value)];
+}
+
+static void MASLayoutTemplateAppendFloat(NSMutableData *data, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    MASLayoutTemplateAppend32(data, bits);
+}
+
+static void MASLayoutTemplateAppendDouble(NSMutableData *data, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    MASLayoutTemplateAppend64(data, bits);
+}
+
+#pragma mark - Reading
+
+typedef struct {
+    const uint8_t *bytes;
+    NSUInteger length;
+    NSUInteger offset;
+    BOOL failed;
+} MASLayoutTemplateReader;
+
+// returns NULL once the data runs out, every later read fails too
+static const uint8_t *MASLayoutTemplateRead(MASLayoutTemplateReader *reader, NSUInteger length) {
+    if (reader->failed || reader->length - reader->offset < length) {
+        reader->failed = YES;
+        return NULL;
+    }
+    const uint8_t *bytes = reader->bytes + reader->offset;
+    reader->offset += length;
+    return bytes;
+}
+
+static uint8_t MASLayoutTemplateRead8(MASLayoutTemplateReader *reader) {
+    const uint8_t *bytes = MASLayoutTemplateRead(reader, 1);
+    return bytes ? *bytes : 0;
+}
+
+static uint16_t MASLayoutTemplateRead16(MASLayoutTemplateReader *reader) {
+    uint16_t value = 0;
+    const uint8_t *bytes = MASLayoutTemplateRead(reader, sizeof(value));
+    if (bytes) memcpy(&value, bytes, sizeof(value));
+    return CFSwapInt16LittleToHost(value);
+}
+
+static uint32_t MASLayoutTemplateRead32(MASLayoutTemplateReader *reader) {
+    uint32_t value = 0;
+    const uint8_t *bytes = MASLayoutTemplateRead(reader, sizeof(value));
+    if (bytes) memcpy(&value, bytes, sizeof(value));
+    return CFSwapInt32LittleToHost(value);
+}
+
+static uint64_t MASLayoutTemplateRead64(MASLayoutTemplateReader *reader) {
+    uint64_t value = 0;
+    const uint8_t *bytes = MASLayoutTemplateRead(reader, sizeof(value));
+    if (bytes) memcpy(&value, bytes, sizeof(value));
+    return CFSwapInt64LittleToHost(value);
+}
+
+static float MASLayoutTemplateReadFloat(MASLayoutTemplateReader *reader) {
+    uint32_t bits = MASLayoutTemplateRead32(reader);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static double MASLayoutTemplateReadDouble(MASLayoutTemplateReader *reader) {
+    uint64_t bits = MASLayoutTemplateRead64(reader);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+typedef NS_ENUM(NSUInteger, MASLayoutTemplateAxis) {
+    MASLayoutTemplateAxisInvalid,
+    MASLayoutTemplateAxisSize,
+    MASLayoutTemplateAxisHorizontal,
+    MASLayoutTemplateAxisVertical,
+};
+
+// attributes NSLayoutConstraint accepts on this platform, only attributes of the same axis can be related
+static MASLayoutTemplateAxis MASLayoutTemplateAxisOfAttribute(NSLayoutAttribute attribute) {
+    switch (attribute) {
+        case NSLayoutAttributeWidth:
+        case NSLayoutAttributeHeight:
+            return MASLayoutTemplateAxisSize;
+        case NSLayoutAttributeLeft:
+        case NSLayoutAttributeRight:
+        case NSLayoutAttributeLeading:
+        case NSLayoutAttributeTrailing:
+        case NSLayoutAttributeCenterX:
+#if TARGET_OS_IPHONE || TARGET_OS_TV
+        case NSLayoutAttributeLeftMargin:
+        case NSLayoutAttributeRightMargin:
+        case NSLayoutAttributeLeadingMargin:
+        case NSLayoutAttributeTrailingMargin:
+        case NSLayoutAttributeCenterXWithinMargins:
+#endif
+            return MASLayoutTemplateAxisHorizontal;
+        case NSLayoutAttributeTop:
+        case NSLayoutAttributeBottom:
+        case NSLayoutAttributeCenterY:
+        case NSLayoutAttributeBaseline:
+        case NSLayoutAttributeFirstBaseline:
+#if TARGET_OS_IPHONE || TARGET_OS_TV
+        case NSLayoutAttributeTopMargin:
+        case NSLayoutAttributeBottomMargin:
+        case NSLayoutAttributeCenterYWithinMargins:
+#endif
+            return MASLayoutTemplateAxisVertical;
+        default:
+            return MASLayoutTemplateAxisInvalid;
+    }
+}
+
+// rejects everything +[NSLayoutConstraint constraintWithItem:...] would throw on, so a bad file fails to load instead of to install
+static BOOL MASLayoutTemplateEntryIsValid(const MASLayoutTemplateEntry *entry) {
+    MASLayoutTemplateAxis axis = MASLayoutTemplateAxisOfAttribute(entry->firstAttribute);
+    if (axis == MASLayoutTemplateAxisInvalid) return NO;
+    if (!isfinite(entry->multiplier) || !isfinite(entry->constant)) return NO;
+    if (!(entry->priority > 0 && entry->priority <= MASLayoutPriorityRequired)) return NO;
+
+    if (entry->secondSlot == MASLayoutTemplateSlotNone) {
+        // only sizes can be constant
+        return axis == MASLayoutTemplateAxisSize && entry->secondAttribute == NSLayoutAttributeNotAnAttribute;
+    }
+    // a zero multiplier turns a location into a constant, which NSLayoutConstraint rejects
+    return MASLayoutTemplateAxisOfAttribute(entry->secondAttribute) == axis && (entry->multiplier != 0 || axis == MASLayoutTemplateAxisSize);
+}
+
+static NSError *MASLayoutTemplateMakeError(MASLayoutTemplateError code, NSString *description) {
+    return [NSError errorWithDomain:MASLayoutTemplateErrorDomain code:code userInfo:@{ NSLocalizedDescriptionKey: description }];
+}
+
+@implementation MASLayoutTemplate (MASSerialization)
+
+#pragma mark - Encoding
+
+- (NSData *)dataRepresentation {
+    NSMutableArray *strings = [NSMutableArray array];
+    NSMutableDictionary *stringIndexes = [NSMutableDictionary dictionary];
+    uint32_t (^indexOfString)(id) = ^uint32_t(id string) {
+        if (string == NSNull.null) return MASLayoutTemplateNoString;
+        NSNumber *index = stringIndexes[string];
+        if (!index) {
+            index = @(strings.count);
+            stringIndexes[string] = index;
+            [strings addObject:string];
+        }
+        return (uint32_t)index.unsignedIntegerValue;
+    };
+    for (NSArray *array in @[self.keys ?: @[], self.tokens ?: @[]]) {
+        for (id string in array) {
+            if (string != NSNull.null && ![string isKindOfClass:NSString.class]) return nil;
+        }
+    }
+
+    NSUInteger count = self.entryCount;
+    NSArray *keys = self.keys;
+    NSArray *tokens = self.tokens;
+    NSMutableData *data = [NSMutableData dataWithCapacity:MASLayoutTemplateHeaderSize + count * MASLayoutTemplateEntrySize];
+
+    [data appendBytes:MASLayoutTemplateMagic length:sizeof(MASLayoutTemplateMagic)];
+    MASLayoutTemplateAppend16(data, MASLayoutTemplateFormatVersion);
+    MASLayoutTemplateAppend16(data, (keys ? MASLayoutTemplateFlagsHasKeys : 0) | (tokens ? MASLayoutTemplateFlagsHasTokens : 0));
+    MASLayoutTemplateAppend32(data, (uint32_t)self.slotCount);
+    MASLayoutTemplateAppend32(data, (uint32_t)count);
+    // the string count is only known once every entry and token has been indexed
+    NSUInteger stringCountOffset = data.length;
+    MASLayoutTemplateAppend32(data, 0);
+    MASLayoutTemplateAppend32(data, 0);
+
+    const MASLayoutTemplateEntry *entries = self.entries;
+    for (NSUInteger i = 0; i < count; i++) {
+        const MASLayoutTemplateEntry *entry = &entries[i];
+        MASLayoutTemplateAppend32(data, (uint32_t)(int32_t)entry->firstSlot);
+        MASLayoutTemplateAppend32(data, (uint32_t)(int32_t)entry->secondSlot);
+        MASLayoutTemplateAppend32(data, (uint32_t)(int32_t)entry->firstAttribute);
+        MASLayoutTemplateAppend32(data, (uint32_t)(int32_t)entry->secondAttribute);
+        MASLayoutTemplateAppend8(data, (uint8_t)(int8_t)entry->relation);
+        MASLayoutTemplateAppend8(data, (uint8_t)entry->firstItem);
+        MASLayoutTemplateAppend8(data, (uint8_t)entry->secondItem);
+        MASLayoutTemplateAppend8(data, 0);
+        MASLayoutTemplateAppend32(data, keys ? indexOfString(keys[i]) : MASLayoutTemplateNoString);
+        MASLayoutTemplateAppendDouble(data, entry->multiplier);
+        MASLayoutTemplateAppendDouble(data, entry->constant);
+        MASLayoutTemplateAppendFloat(data, entry->priority);
+        MASLayoutTemplateAppend32(data, 0);
+    }
+    for (id token in tokens) {
+        MASLayoutTemplateAppend32(data, indexOfString(token));
+    }
+
+    for (NSString *string in strings) {
+        NSData *bytes = [string dataUsingEncoding:NSUTF8StringEncoding];
+        MASLayoutTemplateAppend32(data, (uint32_t)bytes.length);
+        [data appendData:bytes];
+    }
+    uint32_t stringCount = CFSwapInt32HostToLittle((uint32_t)strings.count);
+    [data replaceBytesInRange:NSMakeRange(stringCountOffset, sizeof(stringCount)) withBytes:&stringCount];
+
+    return data;
+}
+
+- (BOOL)writeToFile:(NSString *)path error:(NSError **)error {
+    NSData *data = self.dataRepresentation;
+    if (!data) {
+        if (error) *error = MASLayoutTemplateMakeError(MASLayoutTemplateErrorUnsupportedKey, @"Only string keys and tokens can be serialized");
+        return NO;
+    }
+    return [data writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+#pragma mark - Decoding
+
++ (instancetype)templateWithContentsOfFile:(NSString *)path error:(NSError **)error {
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedAlways error:error];
+    if (!data) return nil;
+    return [self templateWithData:data error:error];
+}
+
++ (instancetype)templateWithData:(NSData *)data error:(NSError **)error {
+    MASLayoutTemplateReader reader = { data.bytes, data.length, 0, NO };
+    NSError *corruptError = MASLayoutTemplateMakeError(MASLayoutTemplateErrorCorruptData, @"Invalid layout template data");
+
+    const uint8_t *magic = MASLayoutTemplateRead(&reader, sizeof(MASLayoutTemplateMagic));
+    if (!magic || memcmp(magic, MASLayoutTemplateMagic, sizeof(MASLayoutTemplateMagic)) != 0) {
+        if (error) *error = corruptError;
+        return nil;
+    }
+    uint16_t version = MASLayoutTemplateRead16(&reader);
+    if (version == 0 || version > MASLayoutTemplateFormatVersion) {
+        if (error) {
+            NSString *description = [NSString stringWithFormat:@"Unsupported layout template version %u", version];
+            *error = MASLayoutTemplateMakeError(MASLayoutTemplateErrorUnsupportedVersion, description);
+        }
+        return nil;
+    }
+    MASLayoutTemplateFlags flags = MASLayoutTemplateRead16(&reader);
+    uint32_t slotCount = MASLayoutTemplateRead32(&reader);
+    uint32_t count = MASLayoutTemplateRead32(&reader);
+    uint32_t stringCount = MASLayoutTemplateRead32(&reader);
+    MASLayoutTemplateRead32(&reader);
+
+    // checked before allocating, a corrupt count cannot ask for more entries than the data holds
+    NSUInteger tokenCount = (flags & MASLayoutTemplateFlagsHasTokens) ? slotCount : 0;
+    if (reader.failed || slotCount > MASLayoutTemplateMaximumSlotCount || (reader.length - reader.offset) / MASLayoutTemplateEntrySize < count
+        || (reader.length - reader.offset - count * MASLayoutTemplateEntrySize) / 4 < tokenCount) {
+        if (error) *error = corruptError;
+        return nil;
+    }
+
+    MASLayoutTemplateEntry *entries = calloc(MAX(count, 1), sizeof(MASLayoutTemplateEntry));
+    uint32_t *keyIndexes = calloc(MAX(count, 1), sizeof(uint32_t));
+    BOOL valid = YES;
+    for (uint32_t i = 0; i < count && valid; i++) {
+        MASLayoutTemplateEntry *entry = &entries[i];
+        entry->firstSlot = (int32_t)MASLayoutTemplateRead32(&reader);
+        entry->secondSlot = (int32_t)MASLayoutTemplateRead32(&reader);
+        entry->firstAttribute = (int32_t)MASLayoutTemplateRead32(&reader);
+        entry->secondAttribute = (int32_t)MASLayoutTemplateRead32(&reader);
+        entry->relation = (int8_t)MASLayoutTemplateRead8(&reader);
+        entry->firstItem = MASLayoutTemplateRead8(&reader);
+        entry->secondItem = MASLayoutTemplateRead8(&reader);
+        MASLayoutTemplateRead8(&reader);
+        keyIndexes[i] = MASLayoutTemplateRead32(&reader);
+        entry->multiplier = MASLayoutTemplateReadDouble(&reader);
+        entry->constant = MASLayoutTemplateReadDouble(&reader);
+        entry->priority = MASLayoutTemplateReadFloat(&reader);
+        MASLayoutTemplateRead32(&reader);
+
+        valid = entry->firstSlot >= 0 && entry->firstSlot < (NSInteger)slotCount
+            && entry->secondSlot >= MASLayoutTemplateSlotSuperview && entry->secondSlot < (NSInteger)slotCount
+            && entry->relation >= NSLayoutRelationLessThanOrEqual && entry->relation <= NSLayoutRelationGreaterThanOrEqual
+            && entry->firstItem <= MASLayoutTemplateItemSafeAreaLayoutGuide && entry->secondItem <= MASLayoutTemplateItemSafeAreaLayoutGuide
+            && (keyIndexes[i] == MASLayoutTemplateNoString || keyIndexes[i] < stringCount)
+            && MASLayoutTemplateEntryIsValid(entry);
+    }
+    uint32_t *tokenIndexes = calloc(MAX(tokenCount, 1), sizeof(uint32_t));
+    for (NSUInteger slot = 0; slot < tokenCount && valid; slot++) {
+        tokenIndexes[slot] = MASLayoutTemplateRead32(&reader);
+        valid = tokenIndexes[slot] < stringCount;
+    }
+
+    NSMutableArray *strings = [NSMutableArray arrayWithCapacity:MIN(stringCount, reader.length / 4)];
+    for (uint32_t i = 0; i < stringCount && valid; i++) {
+        uint32_t length = MASLayoutTemplateRead32(&reader);
+        const uint8_t *bytes = MASLayoutTemplateRead(&reader, length);
+        NSString *string = bytes ? [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding] : nil;
+        valid = string != nil;
+        if (string) [strings addObject:string];
+    }
+
+    MASLayoutTemplate *template = nil;
+    if (valid && !reader.failed) {
+        NSMutableArray *keys = nil;
+        if (flags & MASLayoutTemplateFlagsHasKeys) {
+            keys = [NSMutableArray arrayWithCapacity:count];
+            for (uint32_t i = 0; i < count; i++) {
+                [keys addObject:(keyIndexes[i] == MASLayoutTemplateNoString ? NSNull.null : strings[keyIndexes[i]])];
+            }
+        }
+        if (flags & MASLayoutTemplateFlagsHasTokens) {
+            NSMutableArray *tokens = [NSMutableArray arrayWithCapacity:tokenCount];
+            for (NSUInteger slot = 0; slot < tokenCount; slot++) {
+                [tokens addObject:strings[tokenIndexes[slot]]];
+            }
+            template = [[self alloc] initWithEntries:entries count:count keys:keys tokens:tokens];
+        } else {
+            template = [[self alloc] initWithEntries:entries count:count keys:keys slotCount:slotCount];
+        }
+    } else if (error) {
+        *error = corruptError;
+    }
+    free(entries);
+    free(keyIndexes);
+    free(tokenIndexes);
+    return template;
+}
+
+@end
@@ -0,0 +1,132 @@
+//
+//  MASLayoutTemplate.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+
+/**
+ *	Slot used by an entry which has no second item, eg make.width.equalTo(@10)
+ */
+static const NSInteger MASLayoutTemplateSlotNone = -1;
+
+/**
+ *	Slot used by an entry which refers to the superview of its first item's view
+ *  when that superview is not one of the template's views, eg make.left.equalTo(@10)
+ */
+static const NSInteger MASLayoutTemplateSlotSuperview = -2;
+
+/**
+ *	Which item of a slot's view a template entry refers to
+ */
+typedef NS_ENUM(NSInteger, MASLayoutTemplateItem) {
+    MASLayoutTemplateItemView,
+    MASLayoutTemplateItemSafeAreaLayoutGuide,
+};
+
+/**
+ *  A single constraint of a template with its views replaced by slots
+ */
+typedef struct {
+    NSInteger firstSlot;
+    MASLayoutTemplateItem firstItem;
+    NSLayoutAttribute firstAttribute;
+    NSLayoutRelation relation;
+    NSInteger secondSlot;
+    MASLayoutTemplateItem secondItem;
+    NSLayoutAttribute secondAttribute;
+    CGFloat multiplier;
+    CGFloat constant;
+    MASLayoutPriority priority;
+} MASLayoutTemplateEntry;
+
+/**
+ *  An immutable description of the constraints created by one or more mas_makeConstraints: blocks.
+ *  Views are replaced by symbolic slots so the same description can be stamped onto any set of views
+ *  with the same shape without executing the blocks again, eg once per table view cell.
+ *
+ *  Templates can be read from any thread, installing them must happen on the main thread.
+ */
+@interface MASLayoutTemplate : NSObject <NSCopying>
+
+/**
+ *	The number of view slots, installOnViews: expects an array of this many views
+ */
+@property (nonatomic, assign, readonly) NSUInteger slotCount;
+
+/**
+ *	The number of constraints in the template
+ */
+@property (nonatomic, assign, readonly) NSUInteger entryCount;
+
+/**
+ *	Contiguous array of entryCount entries, owned by the template
+ */
+@property (nonatomic, assign, readonly) const MASLayoutTemplateEntry *entries;
+
+/**
+ *	The mas_key of each entry, NSNull for entries without a key
+ */
+@property (nonatomic, copy, readonly) NSArray *keys;
+
+/**
+ *	The token of each slot for templates made by a MASLayoutTemplateBuilder, nil for recorded templates
+ */
+@property (nonatomic, copy, readonly) NSArray *tokens;
+
+/**
+ *  Records the constraints installed by the block into a template.
+ *  The block is executed exactly once and its constraints are installed on the prototype views as usual.
+ *
+ *  @param views  prototype views, their index in the array becomes their slot
+ *  @param block  scope within which mas_makeConstraints: is called on the prototype views
+ *
+ *  @return a new template
+ */
++ (instancetype)templateWithViews:(NSArray *)views recording:(void(NS_NOESCAPE ^)(void))block;
+
+/**
+ *	The designated initializer.
+ *
+ *	@param	entries	entries to copy
+ *	@param	count	number of entries
+ *	@param	keys	the mas_key of each entry or NSNull, nil if no entry has a key
+ *	@param	slotCount	the number of view slots the entries refer to
+ */
+- (id)initWithEntries:(const MASLayoutTemplateEntry *)entries count:(NSUInteger)count keys:(NSArray *)keys slotCount:(NSUInteger)slotCount;
+
+/**
+ *	Creates a template whose slots are filled by tokens, one slot per token
+ *
+ *	@param	tokens	the token of each slot, in slot order
+ */
+- (id)initWithEntries:(const MASLayoutTemplateEntry *)entries count:(NSUInteger)count keys:(NSArray *)keys tokens:(NSArray *)tokens;
+
+/**
+ *  Creates and activates the template's constraints for a new set of views in one MASConstraintBatch,
+ *  or in the batch that is already open.
+ *
+ *  The constraints are installed like mas_makeConstraints: installs them, without executing any blocks.
+ *  They are returned by +[MASViewConstraint installedConstraintsForView:], so later mas_updateConstraints: calls update them in place
+ *  and mas_remakeConstraints: replaces them.
+ *
+ *  @param views  views to fill the slots with, in the same order as the prototype views
+ *
+ *  @return the installed MASLayoutConstraints
+ */
+- (NSArray *)installOnViews:(NSArray *)views;
+
+/**
+ *  Resolves the tokens of a template made by a MASLayoutTemplateBuilder and installs it like installOnViews:.
+ *  Every constraint is activated in one MASConstraintBatch.
+ *
+ *  @param viewsByToken  the view of each token
+ *
+ *  @return the installed MASLayoutConstraints
+ */
+- (NSArray *)installOnViewsForTokens:(NSDictionary *)viewsByToken;
+
+@end
@@ -0,0 +1,213 @@
+//
+//  MASLayoutTemplate.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASLayoutTemplate.h"
+#import "MASConstraintBatch.h"
+#import "MASLayoutConstraint.h"
+#import "MASViewConstraint.h"
+#import "MASViewConstraint+Private.h"
+#import "View+MASAdditions.h"
+
+@interface MASLayoutTemplate ()
+
+@property (nonatomic, assign, readwrite) NSUInteger slotCount;
+@property (nonatomic, assign, readwrite) NSUInteger entryCount;
+@property (nonatomic, copy, readwrite) NSArray *keys;
+@property (nonatomic, copy, readwrite) NSArray *tokens;
+
+@end
+
+@implementation MASLayoutTemplate {
+    MASLayoutTemplateEntry *_entries;
+    BOOL *_constrainedSlots;
+}
+
+- (id)initWithEntries:(const MASLayoutTemplateEntry *)entries count:(NSUInteger)count keys:(NSArray *)keys slotCount:(NSUInteger)slotCount {
+    self = [super init];
+    if (!self) return nil;
+
+    NSAssert(!keys || keys.count == count, @"expected one key per entry");
+
+    _entries = calloc(MAX(count, 1), sizeof(MASLayoutTemplateEntry));
+    memcpy(_entries, entries, count * sizeof(MASLayoutTemplateEntry));
+    _constrainedSlots = calloc(MAX(slotCount, 1), sizeof(BOOL));
+    for (NSUInteger i = 0; i < count; i++) {
+        NSAssert(entries[i].firstSlot >= 0 && (NSUInteger)entries[i].firstSlot < slotCount, @"invalid first slot %ld", (long)entries[i].firstSlot);
+        NSAssert(entries[i].secondSlot < (NSInteger)slotCount, @"invalid second slot %ld", (long)entries[i].secondSlot);
+        _constrainedSlots[entries[i].firstSlot] = YES;
+    }
+
+    self.entryCount = count;
+    self.slotCount = slotCount;
+    self.keys = keys;
+
+    return self;
+}
+
+- (id)initWithEntries:(const MASLayoutTemplateEntry *)entries count:(NSUInteger)count keys:(NSArray *)keys tokens:(NSArray *)tokens {
+    self = [self initWithEntries:entries count:count keys:keys slotCount:tokens.count];
+    if (!self) return nil;
+
+    self.tokens = tokens;
+
+    return self;
+}
+
+- (void)dealloc {
+    free(_entries);
+    free(_constrainedSlots);
+}
+
+- (const MASLayoutTemplateEntry *)entries {
+    return _entries;
+}
+
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(NSZone __unused *)zone {
+    // immutable
+    return self;
+}
+
+#pragma mark - Recording
+
++ (instancetype)templateWithViews:(NSArray *)views recording:(void(NS_NOESCAPE ^)(void))block {
+    NSAssert(MASConstraintBatch.isSupported, @"Layout templates require +[NSLayoutConstraint activateConstraints:]");
+    NSAssert(!MASConstraintBatch.currentBatch, @"Cannot record a layout template within an open constraint batch");
+
+    // every constraint installed by the block passes through the batch, which is all a template needs to know
+    MASConstraintBatch *batch = [MASConstraintBatch performBatch:block];
+    NSArray *constraints = batch.activatedConstraints;
+
+    NSUInteger count = constraints.count;
+    MASLayoutTemplateEntry *entries = calloc(MAX(count, 1), sizeof(MASLayoutTemplateEntry));
+    NSMutableArray *keys = [NSMutableArray arrayWithCapacity:count];
+    BOOL hasKeys = NO;
+
+    for (NSUInteger i = 0; i < count; i++) {
+        NSLayoutConstraint *constraint = constraints[i];
+        MASLayoutTemplateEntry *entry = &entries[i];
+
+        entry->firstSlot = [self slotForItem:constraint.firstItem inViews:views superviewOf:nil item:&entry->firstItem];
+        NSAssert(entry->firstSlot >= 0 && entry->firstSlot != NSNotFound, @"%@ is not one of the template views", constraint.firstItem);
+        MAS_VIEW *firstView = views[entry->firstSlot];
+
+        entry->secondSlot = [self slotForItem:constraint.secondItem inViews:views superviewOf:firstView item:&entry->secondItem];
+        NSAssert(entry->secondSlot != NSNotFound, @"%@ is not one of the template views nor the superview of %@", constraint.secondItem, firstView);
+
+        entry->firstAttribute = constraint.firstAttribute;
+        entry->relation = constraint.relation;
+        entry->secondAttribute = constraint.secondAttribute;
+        entry->multiplier = constraint.multiplier;
+        entry->constant = constraint.constant;
+        entry->priority = constraint.priority;
+
+        id key = [constraint isKindOfClass:MASLayoutConstraint.class] ? [(MASLayoutConstraint *)constraint mas_key] : nil;
+        hasKeys = hasKeys || key != nil;
+        [keys addObject:key ?: NSNull.null];
+    }
+
+    MASLayoutTemplate *template = [[self alloc] initWithEntries:entries count:count keys:(hasKeys ? keys : nil) slotCount:views.count];
+    free(entries);
+    return template;
+}
+
++ (NSInteger)slotForItem:(id)item inViews:(NSArray *)views superviewOf:(MAS_VIEW *)firstView item:(MASLayoutTemplateItem *)templateItem {
+    *templateItem = MASLayoutTemplateItemView;
+    if (!item) return MASLayoutTemplateSlotNone;
+
+    NSUInteger index = [views indexOfObjectIdenticalTo:item];
+    if (index != NSNotFound) return index;
+
+    id view = item;
+    if ([item respondsToSelector:@selector(owningView)]) {
+        view = [item owningView];
+        if (![view respondsToSelector:@selector(safeAreaLayoutGuide)] || [view safeAreaLayoutGuide] != item) {
+            return NSNotFound;
+        }
+        *templateItem = MASLayoutTemplateItemSafeAreaLayoutGuide;
+        index = [views indexOfObjectIdenticalTo:view];
+        if (index != NSNotFound) return index;
+    }
+
+    if (firstView && view == firstView.superview) {
+        return MASLayoutTemplateSlotSuperview;
+    }
+    return NSNotFound;
+}
+
+#pragma mark - Installing
+
+- (MASViewAttribute *)attribute:(NSLayoutAttribute)attribute ofItem:(MASLayoutTemplateItem)item ofView:(MAS_VIEW *)view {
+    switch (item) {
+#if TARGET_OS_IPHONE || TARGET_OS_TV
+        case MASLayoutTemplateItemSafeAreaLayoutGuide:
+            return [MASViewAttribute attributeWithView:view item:view.safeAreaLayoutGuide layoutAttribute:attribute];
+#endif
+        default:
+            return [MASViewAttribute attributeWithView:view layoutAttribute:attribute];
+    }
+}
+
+- (NSArray *)installOnViews:(NSArray *)views {
+    NSAssert(views.count == self.slotCount, @"expected %lu views, got %lu", (unsigned long)self.slotCount, (unsigned long)views.count);
+
+    for (NSUInteger slot = 0; slot < self.slotCount; slot++) {
+        if (_constrainedSlots[slot]) {
+            [views[slot] setTranslatesAutoresizingMaskIntoConstraints:NO];
+        }
+    }
+
+    NSArray *keys = self.keys;
+    NSMutableArray *constraints = [NSMutableArray arrayWithCapacity:self.entryCount];
+    // installed like mas_makeConstraints: would, so mas_updateConstraints: and mas_remakeConstraints: find the constraints
+    [MASConstraintBatch performBatch:^{
+        [MAS_VIEW mas_performWithCommonSuperviewCache:^{
+            for (NSUInteger i = 0; i < self.entryCount; i++) {
+                const MASLayoutTemplateEntry *entry = &self->_entries[i];
+                MAS_VIEW *firstView = views[entry->firstSlot];
+
+                MAS_VIEW *secondView = nil;
+                if (entry->secondSlot == MASLayoutTemplateSlotSuperview) {
+                    secondView = firstView.superview;
+                    NSAssert(secondView, @"%@ needs a superview to install this template", firstView);
+                } else if (entry->secondSlot >= 0) {
+                    secondView = views[entry->secondSlot];
+                }
+
+                MASViewConstraint *constraint
+                    = [[MASViewConstraint alloc] initWithFirstViewAttribute:[self attribute:entry->firstAttribute ofItem:entry->firstItem ofView:firstView]
+                                                                   relation:entry->relation
+                                                        secondViewAttribute:(secondView ? [self attribute:entry->secondAttribute ofItem:entry->secondItem ofView:secondView] : nil)
+                                                                 multiplier:entry->multiplier
+                                                                   constant:entry->constant
+                                                                   priority:entry->priority];
+                if (keys && keys[i] != NSNull.null) {
+                    constraint.mas_key = keys[i];
+                }
+                [constraint install];
+                [constraints addObject:constraint.layoutConstraint];
+            }
+        }];
+    }];
+    return constraints;
+}
+
+- (NSArray *)installOnViewsForTokens:(NSDictionary *)viewsByToken {
+    NSAssert(self.tokens, @"only templates made by a MASLayoutTemplateBuilder have tokens");
+
+    NSMutableArray *views = [NSMutableArray arrayWithCapacity:self.slotCount];
+    for (id token in self.tokens) {
+        MAS_VIEW *view = viewsByToken[token];
+        NSAssert(view, @"no view for token %@", token);
+        [views addObject:view];
+    }
+    return [self installOnViews:views];
+}
+
+@end
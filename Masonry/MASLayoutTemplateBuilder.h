@@ -0,0 +1,73 @@
+//
+//  MASLayoutTemplateBuilder.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASLayoutTemplate.h"
+
+/**
+ *  Builds a MASLayoutTemplate on any queue without touching views.
+ *
+ *  Views are referenced by tokens, any copyable object such as a string, and every new token is given the next slot.
+ *  The built template is immutable and can be handed to the main thread,
+ *  where -[MASLayoutTemplate installOnViewsForTokens:] resolves the tokens and activates every constraint in one batch.
+ *  A screen building many subviews then only spends the install on the main thread.
+ *
+ *  Unlike templates, a builder must only be used by one queue at a time.
+ */
+@interface MASLayoutTemplateBuilder : NSObject
+
+/**
+ *	The tokens added so far, the index of a token is its slot
+ */
+@property (nonatomic, copy, readonly) NSArray *tokens;
+
+/**
+ *	The number of constraints added so far
+ */
+@property (nonatomic, assign, readonly) NSUInteger entryCount;
+
+/**
+ *	Returns the slot of a token, adding it if it has not been used yet
+ */
+- (NSInteger)slotForToken:(id<NSCopying>)token;
+
+/**
+ *	Adds a constraint between the views of two tokens, mirroring +[NSLayoutConstraint constraintWithItem:attribute:relatedBy:toItem:attribute:multiplier:constant:]
+ *
+ *	@param	token	the token of the first view
+ *	@param	attribute	the attribute of the first view
+ *	@param	relation	the relation between both sides
+ *	@param	otherToken	the token of the second view. If nil, alignment attributes refer to the superview of the first view like make.left.equalTo(@10) does,
+ *                      size attributes are constant
+ *	@param	otherAttribute	the attribute of the second view, NSLayoutAttributeNotAnAttribute to use the first attribute
+ *	@param	multiplier	the multiplier of the second attribute
+ *	@param	constant	the constant
+ *	@param	priority	the priority
+ *	@param	key	the mas_key of the created constraints, nil for none
+ */
+- (void)constrainToken:(id<NSCopying>)token attribute:(NSLayoutAttribute)attribute relatedBy:(NSLayoutRelation)relation
+               toToken:(id<NSCopying>)otherToken attribute:(NSLayoutAttribute)otherAttribute
+            multiplier:(CGFloat)multiplier constant:(CGFloat)constant priority:(MASLayoutPriority)priority key:(id)key;
+
+/**
+ *	Adds a required constraint equating an attribute of two views, or of a view and its superview if otherToken is nil
+ */
+- (void)constrainToken:(id<NSCopying>)token attribute:(NSLayoutAttribute)attribute equalToToken:(id<NSCopying>)otherToken constant:(CGFloat)constant;
+
+/**
+ *	Adds a required constraint setting a size attribute of a view to a constant
+ */
+- (void)constrainToken:(id<NSCopying>)token attribute:(NSLayoutAttribute)attribute equalToConstant:(CGFloat)constant;
+
+/**
+ *	Creates an immutable template of the constraints added so far, whose slots are filled by tokens
+ *
+ *	@return	a new template, or nil if memory ran out while adding a constraint
+ */
+- (MASLayoutTemplate *)build;
+
+@end
@@ -0,0 +1,126 @@
+//
+//  MASLayoutTemplateBuilder.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASLayoutTemplateBuilder.h"
+
+@implementation MASLayoutTemplateBuilder {
+    NSMutableArray *_tokens;
+    NSMutableDictionary *_slotsByToken;
+    NSMutableArray *_keys;
+    BOOL _hasKeys;
+
+    MASLayoutTemplateEntry *_entries;
+    NSUInteger _entryCount;
+    NSUInteger _entryCapacity;
+    // set when growing the entries failed, the constraint was dropped so build returns nil
+    BOOL _failed;
+}
+
+- (id)init {
+    self = [super init];
+    if (!self) return nil;
+
+    _tokens = [NSMutableArray array];
+    _slotsByToken = [NSMutableDictionary dictionary];
+    _keys = [NSMutableArray array];
+
+    return self;
+}
+
+- (void)dealloc {
+    free(_entries);
+}
+
+- (NSArray *)tokens {
+    return [_tokens copy];
+}
+
+- (NSUInteger)entryCount {
+    return _entryCount;
+}
+
+#pragma mark - Adding
+
+- (NSInteger)slotForToken:(id<NSCopying>)token {
+    NSParameterAssert(token);
+    NSNumber *slot = _slotsByToken[token];
+    if (slot) return slot.integerValue;
+
+    NSInteger newSlot = (NSInteger)_tokens.count;
+    id copiedToken = [(id)token copy];
+    [_tokens addObject:copiedToken];
+    _slotsByToken[copiedToken] = @(newSlot);
+    return newSlot;
+}
+
+- (void)constrainToken:(id<NSCopying>)token attribute:(NSLayoutAttribute)attribute relatedBy:(NSLayoutRelation)relation
+               toToken:(id<NSCopying>)otherToken attribute:(NSLayoutAttribute)otherAttribute
+            multiplier:(CGFloat)multiplier constant:(CGFloat)constant priority:(MASLayoutPriority)priority key:(id)key {
+    NSAssert(attribute != NSLayoutAttributeNotAnAttribute, @"a constraint needs a first attribute");
+    if (_failed) return;
+    if (_entryCount == _entryCapacity) {
+        NSUInteger capacity = MAX(_entryCapacity * 2, 16);
+        MASLayoutTemplateEntry *entries = realloc(_entries, capacity * sizeof(MASLayoutTemplateEntry));
+        if (!entries) {
+            _failed = YES;
+            return;
+        }
+        _entries = entries;
+        _entryCapacity = capacity;
+    }
+    MASLayoutTemplateEntry *entry = &_entries[_entryCount++];
+
+    entry->firstSlot = [self slotForToken:token];
+    entry->firstItem = MASLayoutTemplateItemView;
+    entry->firstAttribute = attribute;
+    entry->relation = relation;
+    entry->secondItem = MASLayoutTemplateItemView;
+    entry->multiplier = multiplier;
+    entry->constant = constant;
+    entry->priority = priority;
+
+    if (otherAttribute == NSLayoutAttributeNotAnAttribute) {
+        otherAttribute = attribute;
+    }
+    if (otherToken) {
+        entry->secondSlot = [self slotForToken:otherToken];
+        entry->secondAttribute = otherAttribute;
+    } else if (attribute == NSLayoutAttributeWidth || attribute == NSLayoutAttributeHeight) {
+        entry->secondSlot = MASLayoutTemplateSlotNone;
+        entry->secondAttribute = NSLayoutAttributeNotAnAttribute;
+    } else {
+        // alignment attributes must have a second item, like make.left.equalTo(@10) it is the superview
+        entry->secondSlot = MASLayoutTemplateSlotSuperview;
+        entry->secondAttribute = otherAttribute;
+    }
+
+    _hasKeys = _hasKeys || key != nil;
+    [_keys addObject:key ?: NSNull.null];
+}
+
+- (void)constrainToken:(id<NSCopying>)token attribute:(NSLayoutAttribute)attribute equalToToken:(id<NSCopying>)otherToken constant:(CGFloat)constant {
+    [self constrainToken:token attribute:attribute relatedBy:NSLayoutRelationEqual
+                 toToken:otherToken attribute:NSLayoutAttributeNotAnAttribute
+              multiplier:1 constant:constant priority:MASLayoutPriorityRequired key:nil];
+}
+
+- (void)constrainToken:(id<NSCopying>)token attribute:(NSLayoutAttribute)attribute equalToConstant:(CGFloat)constant {
+    NSAssert(attribute == NSLayoutAttributeWidth || attribute == NSLayoutAttributeHeight, @"only size attributes can equal a constant");
+    [self constrainToken:token attribute:attribute equalToToken:nil constant:constant];
+}
+
+#pragma mark - Building
+
+- (MASLayoutTemplate *)build {
+    if (_failed) return nil;
+    return [[MASLayoutTemplate alloc] initWithEntries:_entries count:_entryCount
+                                                 keys:(_hasKeys ? [_keys copy] : nil)
+                                               tokens:_tokens];
+}
+
+@end
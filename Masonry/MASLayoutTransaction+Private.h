@@ -0,0 +1,21 @@
+//
+//  MASLayoutTransaction+Private.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASLayoutTransaction.h"
+
+/**
+ *	Buffers MASViewConstraints installed with updateExisting, replacing buffered constraints with the same structure
+ *
+ *	@return	NO if nothing is being buffered, in which case the caller installs the constraints itself
+ */
+BOOL MASLayoutTransactionBufferConstraints(NSArray *viewConstraints);
+
+/**
+ *	Applies buffered updates before an install that is not buffered, cheap when nothing is buffered
+ */
+void MASLayoutTransactionFlushIfNeeded(void);
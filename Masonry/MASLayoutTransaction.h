@@ -0,0 +1,61 @@
+//
+//  MASLayoutTransaction.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+
+/**
+ *  Coalesces repeated mas_updateConstraints: calls made within one run loop turn.
+ *
+ *  While a transaction is open, or coalescing is enabled, installing a maker that updates existing constraints
+ *  only buffers its constraints. Buffered constraints are collapsed by structure, ie items, attributes, relation,
+ *  multiplier and priority, so when several updates set the same constraint only the last constant reaches the layout engine.
+ *  The buffer is applied in a single MASConstraintBatch just before Core Animation commits the run loop turn,
+ *  which is when UIKit lays out, or immediately by calling flush.
+ *
+ *  The MASConstraints returned by a buffered mas_updateConstraints: are not installed until the flush.
+ *  Handles returned by updates that a later update replaced are attached to the same layout constraint at the flush,
+ *  with the final constant, so every handle can still change the constant or uninstall it afterwards.
+ *  mas_makeConstraints: and mas_remakeConstraints: are never buffered and flush pending updates first, so mutations keep their order.
+ *  Call flush before laying out synchronously, eg before layoutIfNeeded inside an animation block.
+ *  Must be used on the main thread.
+ */
+@interface MASLayoutTransaction : NSObject
+
+/**
+ *	Buffers the updates installed within the block. Transactions can be nested,
+ *  the buffer is applied before the next layout pass once the outermost one finishes, or by flush
+ */
++ (void)performTransaction:(void(NS_NOESCAPE ^)(void))block;
+
+/**
+ *	Whether or not updates are buffered outside of transactions too, NO by default
+ */
++ (BOOL)isCoalescingEnabled;
++ (void)setCoalescingEnabled:(BOOL)coalescingEnabled;
+
+/**
+ *	Whether or not updates installed now would be buffered
+ */
++ (BOOL)isBuffering;
+
+/**
+ *	Applies every buffered update now
+ */
++ (void)flush;
+
+/**
+ *	The number of distinct constraints currently buffered
+ */
++ (NSUInteger)pendingCount;
+
+/**
+ *	The number of buffered constraints dropped so far because a later update of the same constraint replaced them
+ */
++ (NSUInteger)coalescedCount;
+
+@end
@@ -0,0 +1,159 @@
+//
+//  MASLayoutTransaction.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASLayoutTransaction+Private.h"
+#import "MASViewConstraint.h"
+#import "MASViewConstraint+Private.h"
+#import "MASConstraintSignature.h"
+#import "MASConstraintBatch.h"
+#import "View+MASAdditions.h"
+#import "MASTrace+Private.h"
+
+// runs just before Core Animation commits the run loop turn, which is when UIKit lays out
+static const CFIndex MASLayoutTransactionObserverOrder = 1999000;
+
+// main thread only
+static BOOL MASLayoutTransactionCoalescingEnabled;
+static NSUInteger MASLayoutTransactionDepth;
+static BOOL MASLayoutTransactionFlushing;
+static NSUInteger MASLayoutTransactionCoalescedCount;
+// buffered constraints in the order they were first buffered, a later update of the same structure takes over its slot
+static NSMutableArray *MASLayoutTransactionConstraints;
+static NSMutableDictionary *MASLayoutTransactionIndexes;
+// constraints replaced by a later update and the slot of the constraint that replaced them,
+// they are attached to its layout constraint at flush so every returned handle stays usable
+static NSMutableArray *MASLayoutTransactionSupersededConstraints;
+static NSMutableArray *MASLayoutTransactionSupersededIndexes;
+static CFRunLoopObserverRef MASLayoutTransactionObserver;
+
+static BOOL MASLayoutTransactionIsBuffering(void) {
+    return !MASLayoutTransactionFlushing && (MASLayoutTransactionDepth > 0 || MASLayoutTransactionCoalescingEnabled);
+}
+
+static void MASLayoutTransactionScheduleFlush(void) {
+    if (MASLayoutTransactionObserver) return;
+    MASLayoutTransactionObserver = CFRunLoopObserverCreateWithHandler(kCFAllocatorDefault,
+                                                                      kCFRunLoopBeforeWaiting | kCFRunLoopExit,
+                                                                      true, MASLayoutTransactionObserverOrder,
+                                                                      ^(CFRunLoopObserverRef __unused observer, CFRunLoopActivity __unused activity) {
+        // an open transaction is still collecting, eg while a nested run loop spins inside it
+        if (MASLayoutTransactionDepth > 0) return;
+        [MASLayoutTransaction flush];
+    });
+    CFRunLoopAddObserver(CFRunLoopGetMain(), MASLayoutTransactionObserver, kCFRunLoopCommonModes);
+}
+
+BOOL MASLayoutTransactionBufferConstraints(NSArray *viewConstraints) {
+    if (!MASLayoutTransactionIsBuffering()) return NO;
+
+    if (!MASLayoutTransactionConstraints) {
+        MASLayoutTransactionConstraints = [NSMutableArray array];
+        MASLayoutTransactionIndexes = [NSMutableDictionary dictionary];
+        MASLayoutTransactionSupersededConstraints = [NSMutableArray array];
+        MASLayoutTransactionSupersededIndexes = [NSMutableArray array];
+    }
+    for (MASViewConstraint *constraint in viewConstraints) {
+        MASConstraintSignature *signature = constraint.layoutSignature;
+        NSNumber *index = MASLayoutTransactionIndexes[signature];
+        if (index) {
+            // last write wins, only the final constant of the turn reaches the layout engine
+            [MASLayoutTransactionSupersededConstraints addObject:MASLayoutTransactionConstraints[index.unsignedIntegerValue]];
+            [MASLayoutTransactionSupersededIndexes addObject:index];
+            MASLayoutTransactionConstraints[index.unsignedIntegerValue] = constraint;
+            MASLayoutTransactionCoalescedCount++;
+            continue;
+        }
+        MASLayoutTransactionIndexes[signature] = @(MASLayoutTransactionConstraints.count);
+        [MASLayoutTransactionConstraints addObject:constraint];
+    }
+    MASLayoutTransactionScheduleFlush();
+    return YES;
+}
+
+void MASLayoutTransactionFlushIfNeeded(void) {
+    if (MASLayoutTransactionFlushing || !MASLayoutTransactionConstraints.count) return;
+    [MASLayoutTransaction flush];
+}
+
+@implementation MASLayoutTransaction
+
++ (void)performTransaction:(void(NS_NOESCAPE ^)(void))block {
+    NSParameterAssert(block);
+    MASLayoutTransactionDepth++;
+    @try {
+        block();
+    } @finally {
+        MASLayoutTransactionDepth--;
+    }
+}
+
++ (BOOL)isCoalescingEnabled {
+    return MASLayoutTransactionCoalescingEnabled;
+}
+
++ (void)setCoalescingEnabled:(BOOL)coalescingEnabled {
+    MASLayoutTransactionCoalescingEnabled = coalescingEnabled;
+}
+
++ (BOOL)isBuffering {
+    return MASLayoutTransactionIsBuffering();
+}
+
++ (void)flush {
+    if (MASLayoutTransactionFlushing) return;
+    NSArray *constraints = MASLayoutTransactionConstraints;
+    NSArray *supersededConstraints = MASLayoutTransactionSupersededConstraints;
+    NSArray *supersededIndexes = MASLayoutTransactionSupersededIndexes;
+    MASLayoutTransactionConstraints = nil;
+    MASLayoutTransactionIndexes = nil;
+    MASLayoutTransactionSupersededConstraints = nil;
+    MASLayoutTransactionSupersededIndexes = nil;
+    if (MASLayoutTransactionObserver) {
+        CFRunLoopObserverInvalidate(MASLayoutTransactionObserver);
+        CFRelease(MASLayoutTransactionObserver);
+        MASLayoutTransactionObserver = NULL;
+    }
+    if (!constraints.count) return;
+
+    MAS_TRACE_BEGIN(span, "MASLayoutTransaction flush");
+    MASLayoutTransactionFlushing = YES;
+    @try {
+        [MASConstraintBatch performBatch:^{
+            [MAS_VIEW mas_performWithCommonSuperviewCache:^{
+                for (MASViewConstraint *constraint in constraints) {
+                    // the view may have gone away while its update was buffered
+                    if (!constraint.firstViewAttribute.view) continue;
+                    constraint.updateExisting = YES;
+                    [constraint install];
+                }
+                // finds the layout constraint installed above and shares it, like repeated unbuffered updates do
+                for (NSUInteger i = 0; i < supersededConstraints.count; i++) {
+                    MASViewConstraint *constraint = supersededConstraints[i];
+                    MASViewConstraint *winner = constraints[[supersededIndexes[i] unsignedIntegerValue]];
+                    if (!winner.layoutConstraint) continue;
+                    constraint.layoutConstant = winner.layoutConstant;
+                    constraint.updateExisting = YES;
+                    [constraint install];
+                }
+            }];
+        }];
+    } @finally {
+        MASLayoutTransactionFlushing = NO;
+    }
+    MAS_TRACE_END(span, nil, constraints.count, MASTraceModeUpdate);
+}
+
++ (NSUInteger)pendingCount {
+    return MASLayoutTransactionConstraints.count;
+}
+
++ (NSUInteger)coalescedCount {
+    return MASLayoutTransactionCoalescedCount;
+}
+
+@end
@@ -0,0 +1,274 @@
+//
+//  MASLayoutTree.c
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#include "MASLayoutTree.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    MASIntrinsicHuggingWidth,
+    MASIntrinsicCompressionWidth,
+    MASIntrinsicHuggingHeight,
+    MASIntrinsicCompressionHeight,
+    MASIntrinsicConstraintCount,
+};
+
+typedef struct {
+    MASLayoutItem parent;
+    // position in root coordinates, so constraints between any two items are linear
+    MASLayoutVariable x;
+    MASLayoutVariable y;
+    MASLayoutVariable width;
+    MASLayoutVariable height;
+    double intrinsicWidth;
+    double intrinsicHeight;
+    double priorities[MASIntrinsicConstraintCount];
+    MASLayoutSolverConstraint intrinsicConstraints[MASIntrinsicConstraintCount];
+} MASLayoutTreeItem;
+
+struct MASLayoutTree {
+    MASLayoutSolver *solver;
+    MASLayoutTreeItem *items;
+    int32_t itemCount;
+    int32_t itemCapacity;
+    MASLayoutSolverConstraint rootWidth;
+    MASLayoutSolverConstraint rootHeight;
+    double rootWidthPriority;
+    double rootHeightPriority;
+};
+
+static bool MASLayoutTreeIsItem(const MASLayoutTree *tree, MASLayoutItem item) {
+    return item >= 0 && item < tree->itemCount;
+}
+
+// appends the terms of item.attribute * coefficient, returns false for unsupported attributes
+static bool MASLayoutTreeAppendTerms(const MASLayoutTree *tree, MASLayoutItem item, int32_t attribute, double coefficient,
+                                     MASLayoutSolverTerm *terms, size_t *count) {
+    const MASLayoutTreeItem *treeItem = &tree->items[item];
+    switch (attribute) {
+        case MASLayoutTreeAttributeLeft:
+        case MASLayoutTreeAttributeLeading:
+            terms[(*count)++] = (MASLayoutSolverTerm){ treeItem->x, coefficient };
+            return true;
+        case MASLayoutTreeAttributeRight:
+        case MASLayoutTreeAttributeTrailing:
+            terms[(*count)++] = (MASLayoutSolverTerm){ treeItem->x, coefficient };
+            terms[(*count)++] = (MASLayoutSolverTerm){ treeItem->width, coefficient };
+            return true;
+        case MASLayoutTreeAttributeTop:
+            terms[(*count)++] = (MASLayoutSolverTerm){ treeItem->y, coefficient };
+            return true;
+        case MASLayoutTreeAttributeBottom:
+            terms[(*count)++] = (MASLayoutSolverTerm){ treeItem->y, coefficient };
+            terms[(*count)++] = (MASLayoutSolverTerm){ treeItem->height, coefficient };
+            return true;
+        case MASLayoutTreeAttributeWidth:
+            terms[(*count)++] = (MASLayoutSolverTerm){ treeItem->width, coefficient };
+            return true;
+        case MASLayoutTreeAttributeHeight:
+            terms[(*count)++] = (MASLayoutSolverTerm){ treeItem->height, coefficient };
+            return true;
+        case MASLayoutTreeAttributeCenterX:
+            terms[(*count)++] = (MASLayoutSolverTerm){ treeItem->x, coefficient };
+            terms[(*count)++] = (MASLayoutSolverTerm){ treeItem->width, coefficient * 0.5 };
+            return true;
+        case MASLayoutTreeAttributeCenterY:
+            terms[(*count)++] = (MASLayoutSolverTerm){ treeItem->y, coefficient };
+            terms[(*count)++] = (MASLayoutSolverTerm){ treeItem->height, coefficient * 0.5 };
+            return true;
+        default:
+            return false;
+    }
+}
+
+static MASLayoutSolverStatus MASLayoutTreeFixVariable(MASLayoutTree *tree, MASLayoutVariable variable, double value,
+                                                      MASLayoutSolverRelation relation, double strength,
+                                                      MASLayoutSolverConstraint *constraint) {
+    MASLayoutSolverTerm term = { variable, 1.0 };
+    return MASLayoutSolverAddConstraint(tree->solver, &term, 1, -value, relation, strength, constraint);
+}
+
+MASLayoutTree *MASLayoutTreeCreate(void) {
+    MASLayoutTree *tree = calloc(1, sizeof(MASLayoutTree));
+    if (!tree) abort();
+    tree->solver = MASLayoutSolverCreate();
+    tree->rootWidth = tree->rootHeight = MASLayoutSolverConstraintInvalid;
+
+    MASLayoutItem root = MASLayoutTreeAddItem(tree, MASLayoutItemNone);
+    MASLayoutTreeFixVariable(tree, tree->items[root].x, 0, MASLayoutSolverRelationEqual, MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED, NULL);
+    MASLayoutTreeFixVariable(tree, tree->items[root].y, 0, MASLayoutSolverRelationEqual, MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED, NULL);
+    return tree;
+}
+
+void MASLayoutTreeDestroy(MASLayoutTree *tree) {
+    if (!tree) return;
+    MASLayoutSolverDestroy(tree->solver);
+    free(tree->items);
+    free(tree);
+}
+
+MASLayoutItem MASLayoutTreeAddItem(MASLayoutTree *tree, MASLayoutItem parent) {
+    // only the root has no parent
+    if (tree->itemCount ? !MASLayoutTreeIsItem(tree, parent) : parent != MASLayoutItemNone) return MASLayoutItemNone;
+
+    if (tree->itemCount == tree->itemCapacity) {
+        tree->itemCapacity = tree->itemCapacity ? tree->itemCapacity * 2 : 16;
+        tree->items = realloc(tree->items, (size_t)tree->itemCapacity * sizeof(MASLayoutTreeItem));
+        if (!tree->items) abort();
+    }
+    MASLayoutTreeItem *item = &tree->items[tree->itemCount];
+    item->parent = parent;
+    item->x = MASLayoutSolverAddVariable(tree->solver);
+    item->y = MASLayoutSolverAddVariable(tree->solver);
+    item->width = MASLayoutSolverAddVariable(tree->solver);
+    item->height = MASLayoutSolverAddVariable(tree->solver);
+    item->intrinsicWidth = item->intrinsicHeight = MAS_LAYOUT_TREE_NO_METRIC;
+    item->priorities[MASIntrinsicHuggingWidth] = item->priorities[MASIntrinsicHuggingHeight] = 250;
+    item->priorities[MASIntrinsicCompressionWidth] = item->priorities[MASIntrinsicCompressionHeight] = 750;
+    for (int i = 0; i < MASIntrinsicConstraintCount; i++) {
+        item->intrinsicConstraints[i] = MASLayoutSolverConstraintInvalid;
+    }
+    return tree->itemCount++;
+}
+
+size_t MASLayoutTreeItemCount(const MASLayoutTree *tree) {
+    return (size_t)tree->itemCount;
+}
+
+MASLayoutItem MASLayoutTreeParent(const MASLayoutTree *tree, MASLayoutItem item) {
+    return MASLayoutTreeIsItem(tree, item) ? tree->items[item].parent : MASLayoutItemNone;
+}
+
+static MASLayoutSolverStatus MASLayoutTreeUpdateIntrinsicConstraints(MASLayoutTree *tree, MASLayoutItem item) {
+    MASLayoutTreeItem *treeItem = &tree->items[item];
+    MASLayoutSolverStatus status = MASLayoutSolverStatusOK;
+    for (int i = 0; i < MASIntrinsicConstraintCount; i++) {
+        if (treeItem->intrinsicConstraints[i] != MASLayoutSolverConstraintInvalid) {
+            MASLayoutSolverRemoveConstraint(tree->solver, treeItem->intrinsicConstraints[i]);
+            treeItem->intrinsicConstraints[i] = MASLayoutSolverConstraintInvalid;
+        }
+
+        bool isWidth = i == MASIntrinsicHuggingWidth || i == MASIntrinsicCompressionWidth;
+        double value = isWidth ? treeItem->intrinsicWidth : treeItem->intrinsicHeight;
+        if (value < 0) continue;
+
+        // hugging keeps the item from growing, compression resistance from shrinking
+        bool hugging = i == MASIntrinsicHuggingWidth || i == MASIntrinsicHuggingHeight;
+        MASLayoutSolverStatus result = MASLayoutTreeFixVariable(tree, isWidth ? treeItem->width : treeItem->height, value,
+                                                                hugging ? MASLayoutSolverRelationLessThanOrEqual : MASLayoutSolverRelationGreaterThanOrEqual,
+                                                                MASLayoutSolverStrengthForPriority(treeItem->priorities[i]),
+                                                                &treeItem->intrinsicConstraints[i]);
+        if (result != MASLayoutSolverStatusOK) status = result;
+    }
+    return status;
+}
+
+MASLayoutSolverStatus MASLayoutTreeSetIntrinsicSize(MASLayoutTree *tree, MASLayoutItem item, double width, double height) {
+    if (!MASLayoutTreeIsItem(tree, item)) return MASLayoutSolverStatusInvalidHandle;
+    MASLayoutTreeItem *treeItem = &tree->items[item];
+    if (treeItem->intrinsicWidth == width && treeItem->intrinsicHeight == height) return MASLayoutSolverStatusOK;
+    treeItem->intrinsicWidth = width;
+    treeItem->intrinsicHeight = height;
+    return MASLayoutTreeUpdateIntrinsicConstraints(tree, item);
+}
+
+void MASLayoutTreeSetContentPriorities(MASLayoutTree *tree, MASLayoutItem item,
+                                       double horizontalHugging, double verticalHugging,
+                                       double horizontalCompressionResistance, double verticalCompressionResistance) {
+    if (!MASLayoutTreeIsItem(tree, item)) return;
+    MASLayoutTreeItem *treeItem = &tree->items[item];
+    treeItem->priorities[MASIntrinsicHuggingWidth] = horizontalHugging;
+    treeItem->priorities[MASIntrinsicHuggingHeight] = verticalHugging;
+    treeItem->priorities[MASIntrinsicCompressionWidth] = horizontalCompressionResistance;
+    treeItem->priorities[MASIntrinsicCompressionHeight] = verticalCompressionResistance;
+    MASLayoutTreeUpdateIntrinsicConstraints(tree, item);
+}
+
+MASLayoutSolverStatus MASLayoutTreeAddConstraint(MASLayoutTree *tree, const MASLayoutTreeConstraint *constraint,
+                                                 MASLayoutSolverConstraint *handle) {
+    if (handle) *handle = MASLayoutSolverConstraintInvalid;
+    if (!MASLayoutTreeIsItem(tree, constraint->firstItem)) return MASLayoutSolverStatusInvalidHandle;
+    if (constraint->secondItem != MASLayoutItemNone && !MASLayoutTreeIsItem(tree, constraint->secondItem)) {
+        return MASLayoutSolverStatusInvalidHandle;
+    }
+
+    // first - (second * multiplier + constant) <relation> 0
+    MASLayoutSolverTerm terms[4];
+    size_t count = 0;
+    if (!MASLayoutTreeAppendTerms(tree, constraint->firstItem, constraint->firstAttribute, 1.0, terms, &count)) {
+        return MASLayoutSolverStatusUnsupported;
+    }
+    if (constraint->secondItem != MASLayoutItemNone && constraint->secondAttribute != MASLayoutTreeAttributeNone) {
+        if (!MASLayoutTreeAppendTerms(tree, constraint->secondItem, constraint->secondAttribute, -constraint->multiplier, terms, &count)) {
+            return MASLayoutSolverStatusUnsupported;
+        }
+    }
+    return MASLayoutSolverAddConstraint(tree->solver, terms, count, -constraint->constant, constraint->relation,
+                                        MASLayoutSolverStrengthForPriority(constraint->priority), handle);
+}
+
+MASLayoutSolverStatus MASLayoutTreeSetConstant(MASLayoutTree *tree, MASLayoutSolverConstraint handle, double constant) {
+    // the constant is on the right hand side of the equation
+    return MASLayoutSolverSetConstant(tree->solver, handle, -constant);
+}
+
+MASLayoutSolverStatus MASLayoutTreeSetRootSize(MASLayoutTree *tree, double width, double height) {
+    return MASLayoutTreeSetRootSizeWithPriorities(tree, width, height, 1000, 1000);
+}
+
+MASLayoutSolverStatus MASLayoutTreeSetRootSizeWithPriorities(MASLayoutTree *tree, double width, double height,
+                                                             double horizontalPriority, double verticalPriority) {
+    MASLayoutSolverConstraint *constraints[2] = { &tree->rootWidth, &tree->rootHeight };
+    double *constraintPriorities[2] = { &tree->rootWidthPriority, &tree->rootHeightPriority };
+    MASLayoutVariable variables[2] = { tree->items[MASLayoutItemRoot].width, tree->items[MASLayoutItemRoot].height };
+    double values[2] = { width, height };
+    double priorities[2] = { horizontalPriority, verticalPriority };
+
+    MASLayoutSolverStatus status = MASLayoutSolverStatusOK;
+    for (int i = 0; i < 2; i++) {
+        // resizing the root moves the constant from the previous solution
+        if (*constraints[i] != MASLayoutSolverConstraintInvalid && values[i] >= 0 && *constraintPriorities[i] == priorities[i]) {
+            MASLayoutSolverStatus result = MASLayoutSolverSetConstant(tree->solver, *constraints[i], -values[i]);
+            if (result != MASLayoutSolverStatusOK) status = result;
+            continue;
+        }
+        if (*constraints[i] != MASLayoutSolverConstraintInvalid) {
+            MASLayoutSolverRemoveConstraint(tree->solver, *constraints[i]);
+            *constraints[i] = MASLayoutSolverConstraintInvalid;
+        }
+        if (values[i] < 0) continue;
+        *constraintPriorities[i] = priorities[i];
+        MASLayoutSolverStatus result = MASLayoutTreeFixVariable(tree, variables[i], values[i], MASLayoutSolverRelationEqual,
+                                                                MASLayoutSolverStrengthForPriority(priorities[i]), constraints[i]);
+        if (result != MASLayoutSolverStatusOK) status = result;
+    }
+    return status;
+}
+
+MASLayoutRect MASLayoutTreeFrame(const MASLayoutTree *tree, MASLayoutItem item) {
+    MASLayoutRect frame = { 0, 0, 0, 0 };
+    if (!MASLayoutTreeIsItem(tree, item)) return frame;
+
+    const MASLayoutTreeItem *treeItem = &tree->items[item];
+    frame.x = MASLayoutSolverValue(tree->solver, treeItem->x);
+    frame.y = MASLayoutSolverValue(tree->solver, treeItem->y);
+    frame.width = MASLayoutSolverValue(tree->solver, treeItem->width);
+    frame.height = MASLayoutSolverValue(tree->solver, treeItem->height);
+    if (treeItem->parent != MASLayoutItemNone) {
+        const MASLayoutTreeItem *parent = &tree->items[treeItem->parent];
+        frame.x -= MASLayoutSolverValue(tree->solver, parent->x);
+        frame.y -= MASLayoutSolverValue(tree->solver, parent->y);
+    }
+    return frame;
+}
+
+MASLayoutSolver *MASLayoutTreeSolver(const MASLayoutTree *tree) {
+    return tree->solver;
+}
@@ -0,0 +1,150 @@
+//
+//  MASLayoutTree.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#ifndef MASLayoutTree_h
+#define MASLayoutTree_h
+
+#include "MASLayoutSolver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  A plain data tree of rectangular items laid out by MASLayoutSolver,
+ *  mirroring a view hierarchy and the constraints Masonry installs on it.
+ *
+ *  Items are referred to by index, item 0 is the root created with the tree.
+ *  Frames are relative to the parent item like view frames, the root is placed at the origin.
+ *  Layout is left to right, leading and trailing behave like left and right.
+ */
+typedef struct MASLayoutTree MASLayoutTree;
+
+typedef int32_t MASLayoutItem;
+
+static const MASLayoutItem MASLayoutItemNone = -1;
+static const MASLayoutItem MASLayoutItemRoot = 0;
+
+/**
+ *  Attributes of an item, raw values match NSLayoutAttribute
+ */
+typedef enum {
+    MASLayoutTreeAttributeNone = 0,
+    MASLayoutTreeAttributeLeft = 1,
+    MASLayoutTreeAttributeRight = 2,
+    MASLayoutTreeAttributeTop = 3,
+    MASLayoutTreeAttributeBottom = 4,
+    MASLayoutTreeAttributeLeading = 5,
+    MASLayoutTreeAttributeTrailing = 6,
+    MASLayoutTreeAttributeWidth = 7,
+    MASLayoutTreeAttributeHeight = 8,
+    MASLayoutTreeAttributeCenterX = 9,
+    MASLayoutTreeAttributeCenterY = 10,
+} MASLayoutTreeAttribute;
+
+/**
+ *  `firstItem.firstAttribute <relation> secondItem.secondAttribute * multiplier + constant`
+ *  secondItem is MASLayoutItemNone for constant constraints
+ */
+typedef struct {
+    MASLayoutItem firstItem;
+    int32_t firstAttribute;
+    MASLayoutSolverRelation relation;
+    MASLayoutItem secondItem;
+    int32_t secondAttribute;
+    double multiplier;
+    double constant;
+    double priority;
+} MASLayoutTreeConstraint;
+
+typedef struct {
+    double x;
+    double y;
+    double width;
+    double height;
+} MASLayoutRect;
+
+/**
+ *  Marks an intrinsic or root dimension as absent, like UIViewNoIntrinsicMetric
+ */
+#define MAS_LAYOUT_TREE_NO_METRIC (-1.0)
+
+MASLayoutTree *MASLayoutTreeCreate(void);
+void MASLayoutTreeDestroy(MASLayoutTree *tree);
+
+/**
+ *	Adds an item to the tree
+ *
+ *	@param	parent	an existing item
+ *
+ *	@return	the new item, or MASLayoutItemNone for an unknown parent
+ */
+MASLayoutItem MASLayoutTreeAddItem(MASLayoutTree *tree, MASLayoutItem parent);
+
+size_t MASLayoutTreeItemCount(const MASLayoutTree *tree);
+
+MASLayoutItem MASLayoutTreeParent(const MASLayoutTree *tree, MASLayoutItem item);
+
+/**
+ *	Sets the intrinsic content size of an item, which is enforced with its hugging and compression resistance priorities.
+ *  Either dimension can be MAS_LAYOUT_TREE_NO_METRIC.
+ */
+MASLayoutSolverStatus MASLayoutTreeSetIntrinsicSize(MASLayoutTree *tree, MASLayoutItem item, double width, double height);
+
+/**
+ *	Sets the content hugging and compression resistance priorities of an item, the defaults are 250 and 750
+ */
+void MASLayoutTreeSetContentPriorities(MASLayoutTree *tree, MASLayoutItem item,
+                                       double horizontalHugging, double verticalHugging,
+                                       double horizontalCompressionResistance, double verticalCompressionResistance);
+
+/**
+ *	Adds a constraint between items of the tree
+ *
+ *	@param	handle	set to the solver constraint for later MASLayoutTreeSetConstant calls, may be NULL
+ *
+ *	@return	MASLayoutSolverStatusUnsupported for attributes without a MASLayoutTreeAttribute,
+ *          MASLayoutSolverStatusUnsatisfiable for a conflicting required constraint, which is then ignored like
+ *          the Auto Layout engine breaks it
+ */
+MASLayoutSolverStatus MASLayoutTreeAddConstraint(MASLayoutTree *tree, const MASLayoutTreeConstraint *constraint,
+                                                 MASLayoutSolverConstraint *handle);
+
+/**
+ *	Changes the constant of a constraint added with MASLayoutTreeAddConstraint, re-optimizing incrementally
+ */
+MASLayoutSolverStatus MASLayoutTreeSetConstant(MASLayoutTree *tree, MASLayoutSolverConstraint handle, double constant);
+
+/**
+ *	Fixes the size of the root item, either dimension can be MAS_LAYOUT_TREE_NO_METRIC to leave it to the constraints
+ */
+MASLayoutSolverStatus MASLayoutTreeSetRootSize(MASLayoutTree *tree, double width, double height);
+
+/**
+ *	Sizes the root item like systemLayoutSizeFittingSize:withHorizontalFittingPriority:verticalFittingPriority:,
+ *  a dimension below required priority is only a target the root is pulled towards, eg 0 at priority 50
+ *  for the smallest height that fits the content
+ */
+MASLayoutSolverStatus MASLayoutTreeSetRootSizeWithPriorities(MASLayoutTree *tree, double width, double height,
+                                                             double horizontalPriority, double verticalPriority);
+
+/**
+ *	Returns the frame of an item relative to its parent in the current solution
+ */
+MASLayoutRect MASLayoutTreeFrame(const MASLayoutTree *tree, MASLayoutItem item);
+
+/**
+ *  The solver backing the tree, for adding constraints that can't be described per item
+ */
+MASLayoutSolver *MASLayoutTreeSolver(const MASLayoutTree *tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
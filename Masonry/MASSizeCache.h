@@ -0,0 +1,85 @@
+//
+//  MASSizeCache.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+
+/**
+ *  Caches computed fitting sizes, eg cell heights, keyed by layout identifier, content hash and container width.
+ *
+ *  A layout identifier names one way of laying out content, such as a cell class or reuse identifier.
+ *  Registering the views that implement it makes the cache drop its sizes as soon as
+ *  mas_makeConstraints:, mas_updateConstraints: or mas_remakeConstraints: install or remove
+ *  one of their constraints. Changing constants, eg per row offsets or animations, and remaking identical constraints keep them,
+ *  call invalidateLayoutIdentifier: if a constant change affects the sizes.
+ *  Only the subviews a view has when it is registered are observed, subviews added later are not,
+ *  register the view again after adding subviews to it.
+ *
+ *  The least recently used sizes are evicted beyond countLimit, and all sizes are dropped on memory warnings on iOS and tvOS.
+ *  Sizes can be read and stored from any thread, registering views must happen on the main thread.
+ */
+@interface MASSizeCache : NSObject
+
+/**
+ *	Creates a cache holding at most countLimit sizes
+ */
+- (id)initWithCountLimit:(NSUInteger)countLimit;
+
+/**
+ *	The maximum number of sizes kept, 1000 for caches created with init
+ */
+@property (nonatomic, assign, readonly) NSUInteger countLimit;
+
+/**
+ *	The number of sizes currently cached
+ */
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/**
+ *	Drops the sizes of a layout whenever Masonry constraints of the view or its current subviews are installed or removed.
+ *  Subviews added afterwards are not observed until the view is registered again, which only adds the new ones.
+ *  Views can be registered for several layout identifiers, eg every visible cell.
+ *
+ *	@param	view	a view whose constraints determine the layout's sizes, typically a prototype cell's content view
+ *	@param	layoutIdentifier	the layout the view implements
+ */
+- (void)registerView:(MAS_VIEW *)view forLayoutIdentifier:(id<NSCopying>)layoutIdentifier;
+
+/**
+ *	Looks up a cached size, marking it as recently used
+ *
+ *	@param	size	set to the cached size if there is one
+ *	@param	layoutIdentifier	the layout the size was computed with
+ *	@param	contentHash	identifies the content the size was computed for, eg a hash of the model's displayed fields
+ *	@param	width	the container width the size was computed for
+ *
+ *	@return	whether a size was cached
+ */
+- (BOOL)getSize:(CGSize *)size forLayoutIdentifier:(id<NSCopying>)layoutIdentifier contentHash:(NSUInteger)contentHash width:(CGFloat)width;
+
+/**
+ *	Caches a size, evicting the least recently used size beyond countLimit
+ */
+- (void)setSize:(CGSize)size forLayoutIdentifier:(id<NSCopying>)layoutIdentifier contentHash:(NSUInteger)contentHash width:(CGFloat)width;
+
+/**
+ *	Returns the cached size or caches the size computed by the block, which is called without holding the cache's lock
+ */
+- (CGSize)sizeForLayoutIdentifier:(id<NSCopying>)layoutIdentifier contentHash:(NSUInteger)contentHash width:(CGFloat)width
+                  computeIfNeeded:(CGSize(NS_NOESCAPE ^)(void))block;
+
+/**
+ *	Drops the sizes of one layout, eg after changing something Masonry can't observe such as fonts
+ */
+- (void)invalidateLayoutIdentifier:(id<NSCopying>)layoutIdentifier;
+
+/**
+ *	Drops every cached size, called automatically on memory warnings on iOS and tvOS
+ */
+- (void)removeAllSizes;
+
+@end
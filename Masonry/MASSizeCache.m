@@ -0,0 +1,300 @@
+//
+//  MASSizeCache.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASSizeCache.h"
+#import "MASViewRecord.h"
+#import <pthread.h>
+#import <stdatomic.h>
+
+@interface MASSizeCacheKey : NSObject <NSCopying>
+
+@property (nonatomic, strong, readonly) id layoutIdentifier;
+@property (nonatomic, assign, readonly) NSUInteger contentHash;
+@property (nonatomic, assign, readonly) CGFloat width;
+
+@end
+
+@implementation MASSizeCacheKey {
+    NSUInteger _hash;
+}
+
+- (id)initWithLayoutIdentifier:(id)layoutIdentifier contentHash:(NSUInteger)contentHash width:(CGFloat)width {
+    self = [super init];
+    if (!self) return nil;
+
+    _layoutIdentifier = layoutIdentifier;
+    _contentHash = contentHash;
+    _width = width;
+    _hash = [layoutIdentifier hash] * 31 + contentHash;
+    _hash = _hash * 31 + @(width).hash;
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    // immutable
+    return self;
+}
+
+- (NSUInteger)hash {
+    return _hash;
+}
+
+- (BOOL)isEqual:(MASSizeCacheKey *)other {
+    if (self == other) return YES;
+    if (![other isKindOfClass:MASSizeCacheKey.class]) return NO;
+    return _hash == other->_hash
+        && _contentHash == other->_contentHash
+        && _width == other->_width
+        && [_layoutIdentifier isEqual:other->_layoutIdentifier];
+}
+
+@end
+
+/**
+ *  A cached size, linked into the recently used list
+ */
+@interface MASSizeCacheEntry : NSObject {
+    @public
+    MASSizeCacheKey *_key;
+    CGSize _size;
+    NSUInteger _layoutVersion;
+    __unsafe_unretained MASSizeCacheEntry *_previous;
+    MASSizeCacheEntry *_next;
+}
+@end
+
+@implementation MASSizeCacheEntry
+@end
+
+/**
+ *  The version of a layout identifier's sizes, observing the records of its registered views
+ */
+@interface MASSizeCacheLayout : NSObject <MASViewRecordLayoutObserver> {
+    @public
+    // bumped whenever the cached sizes of the layout become stale, guarded by the cache's lock
+    NSUInteger _version;
+    // set on the main thread by a registered record, folded into _version on the next read
+    atomic_bool _changed;
+}
+@end
+
+@implementation MASSizeCacheLayout
+
+- (void)viewRecordDidChangeLayout:(MASViewRecord __unused *)record {
+    atomic_store_explicit(&_changed, true, memory_order_release);
+}
+
+@end
+
+@implementation MASSizeCache {
+    pthread_mutex_t _lock;
+    NSMutableDictionary *_entries;
+    NSMutableDictionary *_layouts;
+    // most recently used first
+    MASSizeCacheEntry *_head;
+    __unsafe_unretained MASSizeCacheEntry *_tail;
+}
+
+- (id)init {
+    return [self initWithCountLimit:1000];
+}
+
+- (id)initWithCountLimit:(NSUInteger)countLimit {
+    self = [super init];
+    if (!self) return nil;
+
+    _countLimit = MAX(countLimit, 1);
+    pthread_mutex_init(&_lock, NULL);
+    _entries = [NSMutableDictionary dictionary];
+    _layouts = [NSMutableDictionary dictionary];
+
+#if TARGET_OS_IPHONE || TARGET_OS_TV
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(removeAllSizes)
+                                                 name:UIApplicationDidReceiveMemoryWarningNotification
+                                               object:nil];
+#endif
+    return self;
+}
+
+- (void)dealloc {
+#if TARGET_OS_IPHONE || TARGET_OS_TV
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+#endif
+    [self unlinkAllEntries];
+    pthread_mutex_destroy(&_lock);
+}
+
+- (NSUInteger)count {
+    pthread_mutex_lock(&_lock);
+    NSUInteger count = _entries.count;
+    pthread_mutex_unlock(&_lock);
+    return count;
+}
+
+#pragma mark - layouts
+
+- (void)registerView:(MAS_VIEW *)view forLayoutIdentifier:(id<NSCopying>)layoutIdentifier {
+    NSAssert([NSThread isMainThread], @"views must be registered on the main thread");
+
+    pthread_mutex_lock(&_lock);
+    MASSizeCacheLayout *layout = [self layoutForIdentifier:layoutIdentifier];
+    pthread_mutex_unlock(&_lock);
+
+    // a new view alone changes nothing, only its later installs and uninstalls do
+    NSMutableArray *pending = [NSMutableArray arrayWithObject:view];
+    while (pending.count) {
+        MAS_VIEW *current = pending.lastObject;
+        [pending removeLastObject];
+        // views without constraints yet need a record to observe their first ones
+        [[MASViewRecord recordForItem:current] addLayoutObserver:layout];
+        [pending addObjectsFromArray:current.subviews];
+    }
+}
+
+- (void)invalidateLayoutIdentifier:(id<NSCopying>)layoutIdentifier {
+    pthread_mutex_lock(&_lock);
+    MASSizeCacheLayout *layout = _layouts[layoutIdentifier];
+    if (layout) {
+        layout->_version++;
+    }
+    pthread_mutex_unlock(&_lock);
+}
+
+- (MASSizeCacheLayout *)layoutForIdentifier:(id<NSCopying>)layoutIdentifier {
+    MASSizeCacheLayout *layout = _layouts[layoutIdentifier];
+    if (!layout) {
+        layout = [[MASSizeCacheLayout alloc] init];
+        atomic_init(&layout->_changed, false);
+        _layouts[layoutIdentifier] = layout;
+    }
+    return layout;
+}
+
+- (void)validateLayout:(MASSizeCacheLayout *)layout {
+    // constant time however many views are registered, the records mark the layout when they change
+    if (atomic_exchange_explicit(&layout->_changed, false, memory_order_acquire)) {
+        layout->_version++;
+    }
+}
+
+#pragma mark - sizes
+
+- (BOOL)getSize:(CGSize *)size forLayoutIdentifier:(id<NSCopying>)layoutIdentifier contentHash:(NSUInteger)contentHash width:(CGFloat)width {
+    MASSizeCacheKey *key = [[MASSizeCacheKey alloc] initWithLayoutIdentifier:layoutIdentifier contentHash:contentHash width:width];
+
+    pthread_mutex_lock(&_lock);
+    MASSizeCacheEntry *entry = _entries[key];
+    if (entry) {
+        MASSizeCacheLayout *layout = _layouts[layoutIdentifier];
+        [self validateLayout:layout];
+        if (entry->_layoutVersion != layout->_version) {
+            [self removeEntry:entry];
+            entry = nil;
+        } else {
+            [self unlinkEntry:entry];
+            [self linkEntryAtHead:entry];
+            if (size) *size = entry->_size;
+        }
+    }
+    pthread_mutex_unlock(&_lock);
+    return entry != nil;
+}
+
+- (void)setSize:(CGSize)size forLayoutIdentifier:(id<NSCopying>)layoutIdentifier contentHash:(NSUInteger)contentHash width:(CGFloat)width {
+    MASSizeCacheKey *key = [[MASSizeCacheKey alloc] initWithLayoutIdentifier:layoutIdentifier contentHash:contentHash width:width];
+
+    pthread_mutex_lock(&_lock);
+    MASSizeCacheLayout *layout = [self layoutForIdentifier:layoutIdentifier];
+    [self validateLayout:layout];
+
+    MASSizeCacheEntry *entry = _entries[key];
+    if (entry) {
+        [self unlinkEntry:entry];
+    } else {
+        entry = [[MASSizeCacheEntry alloc] init];
+        entry->_key = key;
+        _entries[key] = entry;
+    }
+    entry->_size = size;
+    entry->_layoutVersion = layout->_version;
+    [self linkEntryAtHead:entry];
+
+    while (_entries.count > _countLimit) {
+        [self removeEntry:_tail];
+    }
+    pthread_mutex_unlock(&_lock);
+}
+
+- (CGSize)sizeForLayoutIdentifier:(id<NSCopying>)layoutIdentifier contentHash:(NSUInteger)contentHash width:(CGFloat)width
+                  computeIfNeeded:(CGSize(NS_NOESCAPE ^)(void))block {
+    CGSize size;
+    if ([self getSize:&size forLayoutIdentifier:layoutIdentifier contentHash:contentHash width:width]) {
+        return size;
+    }
+    size = block();
+    [self setSize:size forLayoutIdentifier:layoutIdentifier contentHash:contentHash width:width];
+    return size;
+}
+
+- (void)removeAllSizes {
+    pthread_mutex_lock(&_lock);
+    [self unlinkAllEntries];
+    [_entries removeAllObjects];
+    pthread_mutex_unlock(&_lock);
+}
+
+#pragma mark - recently used list
+
+- (void)linkEntryAtHead:(MASSizeCacheEntry *)entry {
+    entry->_previous = nil;
+    entry->_next = _head;
+    if (_head) {
+        _head->_previous = entry;
+    } else {
+        _tail = entry;
+    }
+    _head = entry;
+}
+
+- (void)unlinkEntry:(MASSizeCacheEntry *)entry {
+    if (entry->_previous) {
+        entry->_previous->_next = entry->_next;
+    } else {
+        _head = entry->_next;
+    }
+    if (entry->_next) {
+        entry->_next->_previous = entry->_previous;
+    } else {
+        _tail = entry->_previous;
+    }
+    entry->_previous = nil;
+    entry->_next = nil;
+}
+
+- (void)removeEntry:(MASSizeCacheEntry *)entry {
+    // the dictionary may hold the last reference to the entry and its key
+    MASSizeCacheKey *key = entry->_key;
+    [self unlinkEntry:entry];
+    [_entries removeObjectForKey:key];
+}
+
+- (void)unlinkAllEntries {
+    // break the chain iteratively, releasing a long list recursively could exhaust the stack
+    MASSizeCacheEntry *entry = _head;
+    _head = nil;
+    _tail = nil;
+    while (entry) {
+        MASSizeCacheEntry *next = entry->_next;
+        entry->_next = nil;
+        entry->_previous = nil;
+        entry = next;
+    }
+}
+
+@end
@@ -0,0 +1,136 @@
+//
+//  MASStack.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+#import "NSArray+MASAdditions.h"
+
+/**
+ *  Chains arranged views one after another along an axis of a container view,
+ *  each view pinned to the end of the previous one and to both edges of the container across the axis.
+ *  The container is pinned to the end of the last view, so it grows with its content, eg the content view of a scroll view.
+ *
+ *  Inserting, removing, moving, hiding or showing a view only rewires the constraints of its neighbours,
+ *  so the cost of a mutation does not depend on the number of arranged views.
+ *  Every mutation is applied to the layout engine in a single MASConstraintBatch, use performBatchUpdates: to share one across mutations.
+ *  The length of each view along the axis is left to its own constraints or intrinsic content size.
+ *  Must be used on the main thread.
+ *
+ *  For long scroll view content, windowing keeps only the views near the visible rect in the container,
+ *  so the layout engine solves for the viewport instead of the whole content. Detached views are stood in for by the
+ *  length they had in their last layout, which is added to the constants of the constraints around them.
+ *  Windowed views should only be constrained to the stack and their own subviews.
+ */
+@interface MASStack : NSObject
+
+/**
+ *	@param	containerView	the view arranged views are added to
+ *	@param	axisType	which axis to chain the views along
+ */
+- (id)initWithContainerView:(MAS_VIEW *)containerView axisType:(MASAxisType)axisType;
+
+@property (nonatomic, weak, readonly) MAS_VIEW *containerView;
+@property (nonatomic, assign, readonly) MASAxisType axisType;
+
+/**
+ *	The spacing between visible views
+ */
+@property (nonatomic, assign) CGFloat spacing;
+
+/**
+ *	The spacing before the first visible view and the container
+ */
+@property (nonatomic, assign) CGFloat leadSpacing;
+
+/**
+ *	The spacing after the last visible view and the container
+ */
+@property (nonatomic, assign) CGFloat tailSpacing;
+
+/**
+ *	The arranged views in order, including hidden ones. Walks the whole stack
+ */
+@property (nonatomic, copy, readonly) NSArray *arrangedViews;
+
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/**
+ *	Appends a view to the end of the stack, adding it to the container view if needed
+ */
+- (void)addArrangedView:(MAS_VIEW *)view;
+
+/**
+ *	Inserts a view at an index. Finding the index walks the stack from its nearer end,
+ *  prefer insertArrangedView:afterView: or insertArrangedView:beforeView: for long stacks
+ */
+- (void)insertArrangedView:(MAS_VIEW *)view atIndex:(NSUInteger)index;
+
+/**
+ *	Inserts a view right after an arranged view, or at the start of the stack if arrangedView is nil
+ */
+- (void)insertArrangedView:(MAS_VIEW *)view afterView:(MAS_VIEW *)arrangedView;
+
+/**
+ *	Inserts a view right before an arranged view, or at the end of the stack if arrangedView is nil
+ */
+- (void)insertArrangedView:(MAS_VIEW *)view beforeView:(MAS_VIEW *)arrangedView;
+
+/**
+ *	Removes a view from the stack, uninstalls the constraints the stack made for it and removes it from its superview
+ */
+- (void)removeArrangedView:(MAS_VIEW *)view;
+
+/**
+ *	Moves an arranged view right after another arranged view, or to the start of the stack if arrangedView is nil
+ */
+- (void)moveArrangedView:(MAS_VIEW *)view afterView:(MAS_VIEW *)arrangedView;
+
+/**
+ *	Hides or shows an arranged view. Hidden views keep their place in the stack but take up no length and no spacing,
+ *  the views around them are chained to each other instead
+ */
+- (void)setArrangedView:(MAS_VIEW *)view hidden:(BOOL)hidden;
+
+/**
+ *	Whether or not the view is arranged by the stack
+ */
+- (BOOL)containsArrangedView:(MAS_VIEW *)view;
+
+/**
+ *	Whether or not only the arranged views overlapping the window are kept in the container, NO by default.
+ *  Turning windowing off adds all detached views back
+ */
+@property (nonatomic, assign, getter=isWindowingEnabled) BOOL windowingEnabled;
+
+/**
+ *	The length beyond both ends of the visible rect within which views are kept in the container, 0 by default
+ */
+@property (nonatomic, assign) CGFloat prefetchLength;
+
+/**
+ *	The length assumed for views that were detached before their first layout, 44 by default
+ */
+@property (nonatomic, assign) CGFloat estimatedLength;
+
+/**
+ *	The arranged views currently kept in the container, in order
+ */
+@property (nonatomic, copy, readonly) NSArray *windowedViews;
+
+/**
+ *	Moves the window to a rect of the container, eg the bounds of the scroll view from scrollViewDidScroll:.
+ *  Views leaving the window are removed from the container and views entering it are added back, all in one batch.
+ *  Views inserted beyond the window stay detached until the window reaches them. Does nothing unless windowing is enabled
+ */
+- (void)updateWindowWithVisibleRect:(CGRect)visibleRect;
+
+/**
+ *	Applies all mutations made within the block to the layout engine at once
+ */
+- (void)performBatchUpdates:(void(NS_NOESCAPE ^)(void))updates;
+
+@end
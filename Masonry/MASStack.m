@@ -0,0 +1,629 @@
+//
+//  MASStack.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASStack.h"
+#import "MASConstraintBatch.h"
+#import "View+MASAdditions.h"
+
+/**
+ *  A node of the doubly linked list of arranged views, owned by the stack's itemsByView table
+ */
+@interface MASStackItem : NSObject
+
+@property (nonatomic, strong) MAS_VIEW *view;
+@property (nonatomic, unsafe_unretained) MASStackItem *prev;
+@property (nonatomic, unsafe_unretained) MASStackItem *next;
+@property (nonatomic, assign) BOOL hidden;
+
+// outside the window, the view is not in the container and has no constraints from the stack
+@property (nonatomic, assign) BOOL detached;
+// while detached, whether the view is after the window rather than before it
+@property (nonatomic, assign) BOOL trailing;
+// the length along the axis from the last layout, which stands in for the view while it is detached
+@property (nonatomic, assign) CGFloat length;
+
+// chains the view to the end of anchorView, or to the start of the container while it has no anchorView
+@property (nonatomic, strong) MASConstraint *leadConstraint;
+@property (nonatomic, weak) MAS_VIEW *anchorView;
+@property (nonatomic, strong) MASConstraint *crossConstraint;
+
+@end
+
+@implementation MASStackItem
+
+@end
+
+@interface MASStack ()
+
+@property (nonatomic, weak, readwrite) MAS_VIEW *containerView;
+@property (nonatomic, assign, readwrite) MASAxisType axisType;
+@property (nonatomic, assign, readwrite) NSUInteger count;
+
+@property (nonatomic, strong) NSMapTable *itemsByView;
+@property (nonatomic, unsafe_unretained) MASStackItem *head;
+@property (nonatomic, unsafe_unretained) MASStackItem *tail;
+
+// the first and last attached items, every item before and after them is detached.
+// While no item is attached windowLast is nil and windowFirst is the item following the gap, nil at the end
+@property (nonatomic, unsafe_unretained) MASStackItem *windowFirst;
+@property (nonatomic, unsafe_unretained) MASStackItem *windowLast;
+
+// the summed last lengths and the number of the visible detached items on either side of the window,
+// so neither moving the window nor rewiring its ends walks the detached items
+@property (nonatomic, assign) CGFloat leadingDetachedLength;
+@property (nonatomic, assign) NSInteger leadingDetachedCount;
+@property (nonatomic, assign) CGFloat trailingDetachedLength;
+@property (nonatomic, assign) NSInteger trailingDetachedCount;
+
+// pins the end of the container to the end of the last visible view
+@property (nonatomic, strong) MASConstraint *tailConstraint;
+@property (nonatomic, weak) MAS_VIEW *tailView;
+
+@end
+
+@implementation MASStack
+
+- (id)initWithContainerView:(MAS_VIEW *)containerView axisType:(MASAxisType)axisType {
+    self = [super init];
+    if (!self) return nil;
+
+    self.containerView = containerView;
+    self.axisType = axisType;
+    self.itemsByView = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                             valueOptions:NSPointerFunctionsStrongMemory];
+    _estimatedLength = 44;
+
+    return self;
+}
+
+#pragma mark - Arranged views
+
+- (NSArray *)arrangedViews {
+    NSMutableArray *views = [NSMutableArray arrayWithCapacity:self.count];
+    for (MASStackItem *item = self.head; item; item = item.next) {
+        [views addObject:item.view];
+    }
+    return views;
+}
+
+- (NSArray *)windowedViews {
+    NSMutableArray *views = [NSMutableArray array];
+    for (MASStackItem *item = self.windowLast ? self.windowFirst : nil; item; item = item.next) {
+        [views addObject:item.view];
+        if (item == self.windowLast) break;
+    }
+    return views;
+}
+
+- (BOOL)containsArrangedView:(MAS_VIEW *)view {
+    return view && [self.itemsByView objectForKey:view] != nil;
+}
+
+- (MASStackItem *)itemForView:(MAS_VIEW *)view {
+    MASStackItem *item = view ? [self.itemsByView objectForKey:view] : nil;
+    NSAssert(!view || item, @"%@ is not arranged by the stack", view);
+    return item;
+}
+
+- (void)addArrangedView:(MAS_VIEW *)view {
+    [self insertArrangedView:view afterItem:self.tail];
+}
+
+- (void)insertArrangedView:(MAS_VIEW *)view atIndex:(NSUInteger)index {
+    NSAssert(index <= self.count, @"Index %lu is beyond the %lu arranged views", (unsigned long)index, (unsigned long)self.count);
+    index = MIN(index, self.count);
+
+    // walk from whichever end is nearer to the item the view goes after
+    MASStackItem *prev;
+    if (index <= self.count / 2) {
+        prev = nil;
+        for (NSUInteger i = 0; i < index; i++) {
+            prev = prev ? prev.next : self.head;
+        }
+    } else {
+        prev = self.tail;
+        for (NSUInteger i = self.count; i > index; i--) {
+            prev = prev.prev;
+        }
+    }
+    [self insertArrangedView:view afterItem:prev];
+}
+
+- (void)insertArrangedView:(MAS_VIEW *)view afterView:(MAS_VIEW *)arrangedView {
+    [self insertArrangedView:view afterItem:[self itemForView:arrangedView]];
+}
+
+- (void)insertArrangedView:(MAS_VIEW *)view beforeView:(MAS_VIEW *)arrangedView {
+    MASStackItem *item = [self itemForView:arrangedView];
+    [self insertArrangedView:view afterItem:(item ? item.prev : self.tail)];
+}
+
+- (void)insertArrangedView:(MAS_VIEW *)view afterItem:(MASStackItem *)prev {
+    NSAssert(view, @"Cannot arrange a nil view");
+    NSAssert(![self containsArrangedView:view], @"%@ is already arranged by the stack", view);
+    if (!view || [self containsArrangedView:view]) return;
+
+    MASStackItem *item = MASStackItem.new;
+    item.view = view;
+    item.hidden = view.hidden;
+    item.length = self.estimatedLength;
+    item.detached = YES;
+    [self.itemsByView setObject:item forKey:view];
+
+    [self performBatchUpdates:^{
+        [self linkItem:item afterItem:prev];
+        [self placeItem:item];
+        [self rewireTail];
+    }];
+}
+
+- (void)removeArrangedView:(MAS_VIEW *)view {
+    MASStackItem *item = [self itemForView:view];
+    if (!item) return;
+
+    [self performBatchUpdates:^{
+        MASStackItem *rewireItem = [self withdrawItem:item];
+        [item.leadConstraint uninstall];
+        [item.crossConstraint uninstall];
+        [self rewireFromItem:rewireItem];
+        [self rewireTail];
+    }];
+    [self.itemsByView removeObjectForKey:view];
+    [view removeFromSuperview];
+}
+
+- (void)moveArrangedView:(MAS_VIEW *)view afterView:(MAS_VIEW *)arrangedView {
+    MASStackItem *item = [self itemForView:view];
+    MASStackItem *prev = [self itemForView:arrangedView];
+    if (!item || item == prev || item.prev == prev) return;
+
+    [self performBatchUpdates:^{
+        [self rewireFromItem:[self withdrawItem:item]];
+        [self linkItem:item afterItem:prev];
+        [self placeItem:item];
+        [self rewireTail];
+    }];
+}
+
+- (void)setArrangedView:(MAS_VIEW *)view hidden:(BOOL)hidden {
+    MASStackItem *item = [self itemForView:view];
+    view.hidden = hidden;
+    if (!item || item.hidden == hidden) return;
+
+    [self performBatchUpdates:^{
+        if (item.detached) {
+            [self addDetachedLengthOfItem:item sign:-1];
+            item.hidden = hidden;
+            [self addDetachedLengthOfItem:item sign:1];
+            if (!item.trailing) {
+                [self rewireFromItem:self.windowFirst];
+            }
+        } else {
+            item.hidden = hidden;
+            [self rewireAroundItem:item];
+        }
+        [self rewireTail];
+    }];
+}
+
+- (void)performBatchUpdates:(void(NS_NOESCAPE ^)(void))updates {
+    // constraints rewired more than once within the batch only reach the layout engine in their final state
+    [MASConstraintBatch performBatch:updates];
+}
+
+#pragma mark - Metrics
+
+- (void)setSpacing:(CGFloat)spacing {
+    if (spacing == _spacing) return;
+    _spacing = spacing;
+    [self rewireAll];
+}
+
+- (void)setLeadSpacing:(CGFloat)leadSpacing {
+    if (leadSpacing == _leadSpacing) return;
+    _leadSpacing = leadSpacing;
+    // only the first attached view is chained to the start of the container
+    [self performBatchUpdates:^{
+        [self rewireFromItem:self.windowFirst];
+    }];
+}
+
+- (void)setTailSpacing:(CGFloat)tailSpacing {
+    if (tailSpacing == _tailSpacing) return;
+    _tailSpacing = tailSpacing;
+    [self performBatchUpdates:^{
+        [self rewireTail];
+    }];
+}
+
+#pragma mark - Windowing
+
+- (void)setWindowingEnabled:(BOOL)windowingEnabled {
+    if (windowingEnabled == _windowingEnabled) return;
+    _windowingEnabled = windowingEnabled;
+    if (windowingEnabled) return;
+
+    [self performBatchUpdates:^{
+        for (MASStackItem *item = self.head; item; item = item.next) {
+            if (item.detached) {
+                [self attachItem:item];
+            }
+        }
+        self.windowFirst = self.head;
+        self.windowLast = self.tail;
+        self.leadingDetachedLength = self.trailingDetachedLength = 0;
+        self.leadingDetachedCount = self.trailingDetachedCount = 0;
+        [self rewireAll];
+    }];
+}
+
+- (CGFloat)lengthOfView:(MAS_VIEW *)view {
+    return self.axisType == MASAxisTypeHorizontal ? CGRectGetWidth(view.frame) : CGRectGetHeight(view.frame);
+}
+
+- (void)updateWindowWithVisibleRect:(CGRect)visibleRect {
+    if (!self.windowingEnabled || !self.head) return;
+
+    BOOL horizontal = self.axisType == MASAxisTypeHorizontal;
+    CGFloat minEdge = (horizontal ? CGRectGetMinX(visibleRect) : CGRectGetMinY(visibleRect)) - self.prefetchLength;
+    CGFloat maxEdge = (horizontal ? CGRectGetMaxX(visibleRect) : CGRectGetMaxY(visibleRect)) + self.prefetchLength;
+    CGFloat leadSpacing = self.leadSpacing;
+    CGFloat spacing = self.spacing;
+
+    // the lengths of attached views are read from their frames
+    [self.containerView layoutIfNeeded];
+    MASStackItem *oldFirst = self.windowFirst;
+    MASStackItem *oldLast = self.windowLast;
+    CGFloat totalLength = self.leadingDetachedLength + self.trailingDetachedLength;
+    NSInteger totalCount = self.leadingDetachedCount + self.trailingDetachedCount;
+    for (MASStackItem *item = oldLast ? oldFirst : nil; item; item = item.next) {
+        if (!item.hidden) {
+            item.length = [self lengthOfView:item.view];
+            totalLength += item.length;
+            totalCount++;
+        }
+        if (item == oldLast) break;
+    }
+
+    // move a cursor from the old start of the window to the first visible view overlapping the new one,
+    // tracking the lengths and number of the visible views before it. Only the views scrolled past are walked
+    MASStackItem *first = oldFirst;
+    NSInteger firstOffset = 0;
+    CGFloat lengthBefore = self.leadingDetachedLength;
+    NSInteger countBefore = self.leadingDetachedCount;
+    for (MASStackItem *prev = first ? first.prev : self.tail; prev; prev = prev.prev) {
+        if (!prev.hidden) {
+            // a visible view ends where the views following it start, less the spacing
+            if (leadSpacing + lengthBefore + countBefore * spacing - spacing < minEdge) break;
+            lengthBefore -= prev.length;
+            countBefore--;
+        }
+        first = prev;
+        firstOffset--;
+    }
+    while (first && (first.hidden || leadSpacing + lengthBefore + countBefore * spacing + first.length < minEdge)) {
+        if (!first.hidden) {
+            lengthBefore += first.length;
+            countBefore++;
+        }
+        first = first.next;
+        firstOffset++;
+    }
+    if (!first || leadSpacing + lengthBefore + countBefore * spacing > maxEdge) {
+        // the window fell between views or beyond the content, keep the nearest view so the container keeps its length
+        MASStackItem *prev = first ? first.prev : self.tail;
+        NSInteger prevOffset = firstOffset - 1;
+        for (; prev && prev.hidden; prev = prev.prev) {
+            prevOffset--;
+        }
+        if (prev) {
+            first = prev;
+            firstOffset = prevOffset;
+            lengthBefore -= prev.length;
+            countBefore--;
+        }
+    }
+    if (!first) return;
+
+    MASStackItem *last = first;
+    NSInteger lastOffset = 0;
+    CGFloat windowLength = first.length;
+    NSInteger windowCount = 1;
+    CGFloat end = leadSpacing + lengthBefore + countBefore * spacing + first.length;
+    NSInteger offset = 0;
+    for (MASStackItem *item = first.next; item; item = item.next) {
+        offset++;
+        if (item.hidden) continue;
+        if (end + spacing > maxEdge) break;
+        end += spacing + item.length;
+        windowLength += item.length;
+        windowCount++;
+        last = item;
+        lastOffset = offset;
+    }
+
+    [self performBatchUpdates:^{
+        // views the start of the window moved past end up before it, the ones it moved back over after it
+        MASStackItem *item = oldFirst;
+        for (NSInteger i = 0; i < firstOffset; i++, item = item.next) {
+            if (!item.detached) {
+                [self detachItem:item];
+            }
+            item.trailing = NO;
+        }
+        item = oldFirst ? oldFirst.prev : self.tail;
+        for (NSInteger i = 0; i > firstOffset; i--, item = item.prev) {
+            item.trailing = YES;
+        }
+        // views of the old window beyond the end of the new one, offsets are relative to the old start of the window
+        NSInteger i = 0;
+        for (item = oldLast ? oldFirst : nil; item; item = item.next, i++) {
+            if (i > firstOffset + lastOffset && !item.detached) {
+                [self detachItem:item];
+                item.trailing = YES;
+            }
+            if (item == oldLast) break;
+        }
+        for (item = first; item; item = item.next) {
+            if (item.detached) {
+                [self attachItem:item];
+            }
+            if (item == last) break;
+        }
+
+        self.windowFirst = first;
+        self.windowLast = last;
+        self.leadingDetachedLength = lengthBefore;
+        self.leadingDetachedCount = countBefore;
+        self.trailingDetachedLength = totalLength - lengthBefore - windowLength;
+        self.trailingDetachedCount = totalCount - countBefore - windowCount;
+
+        for (item = first; item; item = item.next) {
+            [self rewireItem:item];
+            if (item == last) break;
+        }
+        [self rewireTail];
+    }];
+}
+
+- (BOOL)shouldAttachItem:(MASStackItem *)item {
+    // views inserted within the window join it, views inserted beyond it are detached until it reaches them
+    if (!self.windowingEnabled) return YES;
+    return (!item.prev || !item.prev.detached) && (!item.next || !item.next.detached);
+}
+
+/**
+ *	Attaches an item that was just linked if it joins the window, otherwise keeps it detached and counts its length
+ */
+- (void)placeItem:(MASStackItem *)item {
+    if ([self shouldAttachItem:item]) {
+        if (item.detached) {
+            [self attachItem:item];
+        }
+        if (!self.windowLast) {
+            self.windowFirst = self.windowLast = item;
+        } else if (item.next == self.windowFirst) {
+            self.windowFirst = item;
+        } else if (item.prev == self.windowLast) {
+            self.windowLast = item;
+        }
+        [self rewireAroundItem:item];
+        return;
+    }
+
+    if (!item.detached) {
+        [self detachItem:item];
+    } else if (item.view.superview == self.containerView) {
+        [item.view removeFromSuperview];
+    }
+    item.trailing = item.prev && (!item.prev.detached || item.prev.trailing);
+    [self addDetachedLengthOfItem:item sign:1];
+    if (!item.trailing) {
+        // the start of the window moves along with the views before it
+        [self rewireFromItem:self.windowFirst];
+    }
+}
+
+/**
+ *	Takes an item out of the window or out of the detached lengths and unlinks it
+ *
+ *	@return	the item the chain has to be rewired from
+ */
+- (MASStackItem *)withdrawItem:(MASStackItem *)item {
+    MASStackItem *next = item.next;
+    if (item.detached) {
+        [self addDetachedLengthOfItem:item sign:-1];
+        if (item == self.windowFirst) {
+            // only while the window is empty
+            self.windowFirst = next;
+        }
+        [self unlinkItem:item];
+        return item.trailing ? nil : self.windowFirst;
+    }
+
+    if (item == self.windowFirst && item == self.windowLast) {
+        // the items before and after the empty window stay on their side of it
+        self.windowFirst = next;
+        self.windowLast = nil;
+    } else if (item == self.windowFirst) {
+        self.windowFirst = next;
+    } else if (item == self.windowLast) {
+        self.windowLast = item.prev;
+    }
+    [self unlinkItem:item];
+    return next;
+}
+
+- (void)addDetachedLengthOfItem:(MASStackItem *)item sign:(NSInteger)sign {
+    if (item.hidden) return;
+    if (item.trailing) {
+        self.trailingDetachedLength += sign * item.length;
+        self.trailingDetachedCount += sign;
+    } else {
+        self.leadingDetachedLength += sign * item.length;
+        self.leadingDetachedCount += sign;
+    }
+}
+
+- (void)attachItem:(MASStackItem *)item {
+    MAS_VIEW *view = item.view;
+    MAS_VIEW *containerView = self.containerView;
+    item.detached = NO;
+    if (view.superview != containerView) {
+        [containerView addSubview:view];
+    }
+    BOOL horizontal = self.axisType == MASAxisTypeHorizontal;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        item.crossConstraint = (horizontal ? make.top.bottom : make.left.right).equalTo(containerView);
+    }];
+}
+
+- (void)detachItem:(MASStackItem *)item {
+    item.detached = YES;
+    [item.leadConstraint uninstall];
+    [item.crossConstraint uninstall];
+    item.leadConstraint = nil;
+    item.crossConstraint = nil;
+    item.anchorView = nil;
+    // takes the view's own constraints and subviews out of the layout engine too
+    [item.view removeFromSuperview];
+}
+
+#pragma mark - Linking
+
+- (void)linkItem:(MASStackItem *)item afterItem:(MASStackItem *)prev {
+    MASStackItem *next = prev ? prev.next : self.head;
+    item.prev = prev;
+    item.next = next;
+    if (prev) {
+        prev.next = item;
+    } else {
+        self.head = item;
+    }
+    if (next) {
+        next.prev = item;
+    } else {
+        self.tail = item;
+    }
+    self.count++;
+}
+
+- (void)unlinkItem:(MASStackItem *)item {
+    if (item.prev) {
+        item.prev.next = item.next;
+    } else {
+        self.head = item.next;
+    }
+    if (item.next) {
+        item.next.prev = item.prev;
+    } else {
+        self.tail = item.prev;
+    }
+    item.prev = nil;
+    item.next = nil;
+    self.count--;
+}
+
+#pragma mark - Rewiring
+
+- (BOOL)isChainedItem:(MASStackItem *)item {
+    return !item.hidden && !item.detached;
+}
+
+/**
+ *	Rewires an item whose neighbours or visibility changed, along with the items following it up to the next visible attached one,
+ *  which are the only ones chained to what came before it
+ */
+- (void)rewireFromItem:(MASStackItem *)item {
+    // nothing is chained to the detached items after the window
+    for (; item && !item.detached; item = item.next) {
+        [self rewireItem:item];
+        if ([self isChainedItem:item]) break;
+    }
+}
+
+/**
+ *	Rewires an item that was just linked or shown, along with the items following it up to the next visible attached one,
+ *  which were chained to whatever came before the item
+ */
+- (void)rewireAroundItem:(MASStackItem *)item {
+    [self rewireItem:item];
+    [self rewireFromItem:item.next];
+}
+
+- (void)rewireAll {
+    [self performBatchUpdates:^{
+        // detached items have no constraints to rewire
+        for (MASStackItem *item = self.windowLast ? self.windowFirst : nil; item; item = item.next) {
+            [self rewireItem:item];
+            if (item == self.windowLast) break;
+        }
+        [self rewireTail];
+    }];
+}
+
+- (void)rewireItem:(MASStackItem *)item {
+    if (item.detached) return;
+
+    MASStackItem *anchor = item.prev;
+    while (anchor && anchor.hidden && !anchor.detached) {
+        anchor = anchor.prev;
+    }
+    CGFloat detachedLength = 0;
+    if (anchor.detached) {
+        // the item starts the window, the detached views before it are stood in for by their last length and spacing
+        detachedLength = self.leadingDetachedLength + self.leadingDetachedCount * self.spacing;
+        anchor = nil;
+    }
+    MAS_VIEW *anchorView = anchor.view;
+    // hidden views sit at the end of the previous visible view without taking up spacing
+    CGFloat offset = detachedLength + (item.hidden ? 0 : (anchorView ? self.spacing : self.leadSpacing));
+
+    if (item.leadConstraint && item.anchorView == anchorView) {
+        item.leadConstraint.offset = offset;
+        return;
+    }
+
+    [item.leadConstraint uninstall];
+    item.anchorView = anchorView;
+    BOOL horizontal = self.axisType == MASAxisTypeHorizontal;
+    id anchorAttribute = anchorView ? (horizontal ? anchorView.mas_right : anchorView.mas_bottom) : self.containerView;
+    [item.view mas_makeConstraints:^(MASConstraintMaker *make) {
+        item.leadConstraint = (horizontal ? make.left : make.top).equalTo(anchorAttribute).offset(offset);
+    }];
+}
+
+- (void)rewireTail {
+    MASStackItem *last = self.windowLast;
+    while (last && last.hidden && !last.detached) {
+        last = last.prev;
+    }
+    if (last.detached) {
+        last = nil;
+    }
+    // the detached views after the window are stood in for by their last length and spacing
+    CGFloat offset = -(self.tailSpacing + self.trailingDetachedLength + self.trailingDetachedCount * self.spacing);
+
+    if (self.tailConstraint && last.view == self.tailView) {
+        self.tailConstraint.offset = offset;
+        return;
+    }
+
+    [self.tailConstraint uninstall];
+    self.tailConstraint = nil;
+    self.tailView = last.view;
+    if (!last) return;
+
+    BOOL horizontal = self.axisType == MASAxisTypeHorizontal;
+    MAS_VIEW *containerView = self.containerView;
+    [last.view mas_makeConstraints:^(MASConstraintMaker *make) {
+        self.tailConstraint = (horizontal ? make.right : make.bottom).equalTo(containerView).offset(offset);
+    }];
+}
+
+@end
@@ -0,0 +1,48 @@
+//
+//  MASTrace+Private.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASTrace.h"
+
+typedef NS_ENUM(uint8_t, MASTraceMode) {
+    MASTraceModeNone,
+    MASTraceModeMake,
+    MASTraceModeUpdate,
+    MASTraceModeRemake,
+};
+
+/**
+ *  A span being timed, start is 0 while tracing is disabled
+ */
+typedef struct {
+    const char *name;
+    uint64_t start;
+} MASTraceSpan;
+
+/**
+ *  Set through +[MASTrace setEnabled:], read on every traced operation
+ */
+extern BOOL MASTraceEnabled;
+
+uint64_t MASTraceNow(void);
+
+/**
+ *	Records a finished span into the calling thread's ring buffer
+ */
+void MASTraceRecord(const MASTraceSpan *span, id key, NSUInteger constraintCount, MASTraceMode mode);
+
+/**
+ *  Starts timing a span named by a string literal, the only cost while tracing is disabled is the branch on MASTraceEnabled
+ */
+#define MAS_TRACE_BEGIN(span, spanName) \
+    MASTraceSpan span = { spanName, __builtin_expect(MASTraceEnabled, NO) ? MASTraceNow() : 0 }
+
+/**
+ *  Ends a span, the arguments are only evaluated when the span is being timed
+ */
+#define MAS_TRACE_END(span, key, constraintCount, mode) \
+    do { if (__builtin_expect(span.start != 0, 0)) MASTraceRecord(&span, (key), (constraintCount), (mode)); } while (0)
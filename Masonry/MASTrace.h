@@ -0,0 +1,51 @@
+//
+//  MASTrace.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+
+/**
+ *  Opt-in tracing of where Masonry spends its time.
+ *
+ *  While enabled, the mas_makeConstraints:, mas_updateConstraints: and mas_remakeConstraints: entry points,
+ *  installing and uninstalling constraints, looking up existing constraints and closest common superviews
+ *  record timed spans with the view's mas_key, the number of constraints involved and whether they were made, updated or remade.
+ *
+ *  Each thread records into its own ring buffer without locking, keeping the most recent spans.
+ *  The spans export as Chrome trace JSON, which chrome://tracing, Perfetto and Instruments can open.
+ *  While disabled, tracing costs a single branch per traced operation.
+ */
+@interface MASTrace : NSObject
+
+/**
+ *	Whether spans are recorded, NO by default
+ */
++ (BOOL)isEnabled;
++ (void)setEnabled:(BOOL)enabled;
+
+/**
+ *	Number of spans each thread keeps before overwriting its oldest ones, applies to threads that haven't recorded yet
+ */
++ (NSUInteger)bufferCapacity;
++ (void)setBufferCapacity:(NSUInteger)bufferCapacity;
+
+/**
+ *	Discards the spans recorded so far by every thread
+ */
++ (void)reset;
+
+/**
+ *	The recorded spans in the Chrome trace event format, ordered by start time
+ */
++ (NSData *)chromeTraceData;
+
+/**
+ *	Writes chromeTraceData to a file
+ */
++ (BOOL)writeChromeTraceToFile:(NSString *)path error:(NSError **)error;
+
+@end
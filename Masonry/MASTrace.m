@@ -0,0 +1,210 @@
+//
+//  MASTrace.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASTrace+Private.h"
+#import <mach/mach_time.h>
+#import <pthread.h>
+#import <stdatomic.h>
+
+#define MAS_TRACE_KEY_LENGTH 48
+
+typedef struct {
+    // odd while the event is written, 2 * (index + 1) once event number index is complete
+    _Atomic uint64_t sequence;
+    const char *name;
+    uint64_t threadID;
+    uint64_t start;
+    uint64_t end;
+    NSUInteger constraintCount;
+    MASTraceMode mode;
+    char key[MAS_TRACE_KEY_LENGTH];
+} MASTraceEvent;
+
+/**
+ *  Ring buffer written by a single thread, buffers are never freed and are reused once their thread exits
+ */
+typedef struct MASTraceBuffer {
+    struct MASTraceBuffer *next;
+    _Atomic bool inUse;
+    uint64_t threadID;
+    _Atomic uint64_t writeCount;
+    NSUInteger capacity;
+    MASTraceEvent events[];
+} MASTraceBuffer;
+
+BOOL MASTraceEnabled = NO;
+
+static _Atomic(MASTraceBuffer *) MASTraceBuffers;
+static _Atomic uint64_t MASTraceResetTime;
+static _Atomic NSUInteger MASTraceBufferCapacity = 4096;
+static pthread_key_t MASTraceBufferKey;
+
+static void MASTraceReleaseBuffer(void *buffer) {
+    atomic_store_explicit(&((MASTraceBuffer *)buffer)->inUse, false, memory_order_release);
+}
+
+static MASTraceBuffer *MASTraceCurrentBuffer(void) {
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        pthread_key_create(&MASTraceBufferKey, MASTraceReleaseBuffer);
+    });
+
+    MASTraceBuffer *buffer = pthread_getspecific(MASTraceBufferKey);
+    if (buffer) return buffer;
+
+    uint64_t threadID = 0;
+    pthread_threadid_np(NULL, &threadID);
+    NSUInteger capacity = atomic_load_explicit(&MASTraceBufferCapacity, memory_order_relaxed);
+
+    // take over the buffer of an exited thread before growing the list
+    for (buffer = atomic_load_explicit(&MASTraceBuffers, memory_order_acquire); buffer; buffer = buffer->next) {
+        bool inUse = false;
+        if (buffer->capacity == capacity
+            && atomic_compare_exchange_strong_explicit(&buffer->inUse, &inUse, true, memory_order_acquire, memory_order_relaxed)) {
+            break;
+        }
+    }
+    if (!buffer) {
+        buffer = calloc(1, sizeof(MASTraceBuffer) + capacity * sizeof(MASTraceEvent));
+        if (!buffer) return NULL;
+        buffer->capacity = capacity;
+        atomic_init(&buffer->inUse, true);
+        MASTraceBuffer *head = atomic_load_explicit(&MASTraceBuffers, memory_order_relaxed);
+        do {
+            buffer->next = head;
+        } while (!atomic_compare_exchange_weak_explicit(&MASTraceBuffers, &head, buffer, memory_order_release, memory_order_relaxed));
+    }
+    buffer->threadID = threadID;
+    pthread_setspecific(MASTraceBufferKey, buffer);
+    return buffer;
+}
+
+static void MASTraceCopyKey(id key, char *buffer) {
+    buffer[0] = '\0';
+    if (!key) return;
+
+    NSString *string = [key isKindOfClass:NSString.class] ? key : [key description];
+    NSUInteger length = 0;
+    // copies whole characters only, so truncated keys stay valid UTF-8
+    [string getBytes:buffer maxLength:MAS_TRACE_KEY_LENGTH - 1 usedLength:&length encoding:NSUTF8StringEncoding
+             options:0 range:NSMakeRange(0, string.length) remainingRange:NULL];
+    buffer[length] = '\0';
+}
+
+uint64_t MASTraceNow(void) {
+    return mach_absolute_time();
+}
+
+void MASTraceRecord(const MASTraceSpan *span, id key, NSUInteger constraintCount, MASTraceMode mode) {
+    uint64_t end = MASTraceNow();
+    MASTraceBuffer *buffer = MASTraceCurrentBuffer();
+    if (!buffer) return;
+
+    uint64_t index = atomic_load_explicit(&buffer->writeCount, memory_order_relaxed);
+    MASTraceEvent *event = &buffer->events[index % buffer->capacity];
+    atomic_store_explicit(&event->sequence, 2 * index + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    event->name = span->name;
+    event->threadID = buffer->threadID;
+    event->start = span->start;
+    event->end = end;
+    event->constraintCount = constraintCount;
+    event->mode = mode;
+    MASTraceCopyKey(key, event->key);
+
+    atomic_store_explicit(&event->sequence, 2 * (index + 1), memory_order_release);
+    atomic_store_explicit(&buffer->writeCount, index + 1, memory_order_release);
+}
+
+@implementation MASTrace
+
++ (BOOL)isEnabled {
+    return MASTraceEnabled;
+}
+
++ (void)setEnabled:(BOOL)enabled {
+    MASTraceEnabled = enabled;
+}
+
++ (NSUInteger)bufferCapacity {
+    return atomic_load_explicit(&MASTraceBufferCapacity, memory_order_relaxed);
+}
+
++ (void)setBufferCapacity:(NSUInteger)bufferCapacity {
+    atomic_store_explicit(&MASTraceBufferCapacity, MAX(bufferCapacity, 1), memory_order_relaxed);
+}
+
++ (void)reset {
+    // buffers belong to their threads, so older spans are hidden instead of cleared
+    atomic_store_explicit(&MASTraceResetTime, MASTraceNow(), memory_order_relaxed);
+}
+
++ (NSData *)chromeTraceData {
+    mach_timebase_info_data_t timebase;
+    mach_timebase_info(&timebase);
+    double microsecondsPerTick = (double)timebase.numer / timebase.denom / 1000.0;
+    uint64_t resetTime = atomic_load_explicit(&MASTraceResetTime, memory_order_relaxed);
+    int processID = NSProcessInfo.processInfo.processIdentifier;
+    NSArray *modeNames = @[@"none", @"make", @"update", @"remake"];
+
+    NSMutableArray *traceEvents = [NSMutableArray array];
+    for (MASTraceBuffer *buffer = atomic_load_explicit(&MASTraceBuffers, memory_order_acquire); buffer; buffer = buffer->next) {
+        uint64_t count = atomic_load_explicit(&buffer->writeCount, memory_order_acquire);
+        uint64_t first = count > buffer->capacity ? count - buffer->capacity : 0;
+
+        for (uint64_t index = first; index < count; index++) {
+            MASTraceEvent *slot = &buffer->events[index % buffer->capacity];
+            uint64_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+            if (sequence != 2 * (index + 1)) continue;
+
+            MASTraceEvent event;
+            event.name = slot->name;
+            event.threadID = slot->threadID;
+            event.start = slot->start;
+            event.end = slot->end;
+            event.constraintCount = slot->constraintCount;
+            event.mode = slot->mode;
+            memcpy(event.key, slot->key, MAS_TRACE_KEY_LENGTH);
+            event.key[MAS_TRACE_KEY_LENGTH - 1] = '\0';
+
+            // the owning thread overwrote the slot while it was copied
+            atomic_thread_fence(memory_order_acquire);
+            if (atomic_load_explicit(&slot->sequence, memory_order_relaxed) != sequence) continue;
+            if (event.start < resetTime) continue;
+
+            NSMutableDictionary *args = [NSMutableDictionary dictionaryWithCapacity:3];
+            args[@"constraints"] = @(event.constraintCount);
+            if (event.mode != MASTraceModeNone) {
+                args[@"mode"] = modeNames[event.mode];
+            }
+            if (event.key[0]) {
+                args[@"key"] = [NSString stringWithUTF8String:event.key] ?: @"";
+            }
+            [traceEvents addObject:@{
+                @"name": @(event.name),
+                @"cat": @"Masonry",
+                @"ph": @"X",
+                @"ts": @(event.start * microsecondsPerTick),
+                @"dur": @((event.end - event.start) * microsecondsPerTick),
+                @"pid": @(processID),
+                @"tid": @(event.threadID),
+                @"args": args,
+            }];
+        }
+    }
+    [traceEvents sortUsingDescriptors:@[[NSSortDescriptor sortDescriptorWithKey:@"ts" ascending:YES]]];
+
+    return [NSJSONSerialization dataWithJSONObject:@{ @"traceEvents": traceEvents, @"displayTimeUnit": @"ns" } options:0 error:NULL];
+}
+
++ (BOOL)writeChromeTraceToFile:(NSString *)path error:(NSError **)error {
+    return [self.chromeTraceData writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+@end
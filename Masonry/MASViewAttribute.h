@@ -39,6 +39,18 @@
  */
 - (id)initWithView:(MAS_VIEW *)view item:(id)item layoutAttribute:(NSLayoutAttribute)layoutAttribute;
 
+/**
+ *  Returns the shared attribute for the view and layoutAttribute.
+ *  Attributes are immutable, so repeated calls return the same instance for as long as the view is alive.
+ */
++ (instancetype)attributeWithView:(MAS_VIEW *)view layoutAttribute:(NSLayoutAttribute)layoutAttribute;
+
+/**
+ *  Returns the shared attribute for the view, item and layoutAttribute.
+ *  The attribute is cached on the item, if the item is later paired with a different view a new attribute is returned.
+ */
++ (instancetype)attributeWithView:(MAS_VIEW *)view item:(id)item layoutAttribute:(NSLayoutAttribute)layoutAttribute;
+
 /**
  *	Determine whether the layoutAttribute is a size attribute
  *
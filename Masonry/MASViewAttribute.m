@@ -7,9 +7,28 @@
 //
 
 #import "MASViewAttribute.h"
+#import "MASViewRecord.h"
 
 @implementation MASViewAttribute
 
++ (instancetype)attributeWithView:(MAS_VIEW *)view layoutAttribute:(NSLayoutAttribute)layoutAttribute {
+    return [self attributeWithView:view item:view layoutAttribute:layoutAttribute];
+}
+
++ (instancetype)attributeWithView:(MAS_VIEW *)view item:(id)item layoutAttribute:(NSLayoutAttribute)layoutAttribute {
+    if (!item || layoutAttribute < 0 || layoutAttribute >= MAS_VIEW_RECORD_ATTRIBUTE_COUNT || self != MASViewAttribute.class) {
+        return [[self alloc] initWithView:view item:item layoutAttribute:layoutAttribute];
+    }
+
+    MASViewRecord *record = [MASViewRecord recordForItem:item];
+    MASViewAttribute *attribute = record->_attributes[layoutAttribute];
+    if (!attribute || attribute.view != view) {
+        attribute = [[self alloc] initWithView:view item:item layoutAttribute:layoutAttribute];
+        record->_attributes[layoutAttribute] = attribute;
+    }
+    return attribute;
+}
+
 - (id)initWithView:(MAS_VIEW *)view layoutAttribute:(NSLayoutAttribute)layoutAttribute {
     self = [self initWithView:view item:view layoutAttribute:layoutAttribute];
     return self;
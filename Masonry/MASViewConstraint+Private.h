@@ -0,0 +1,60 @@
+//
+//  MASViewConstraint+Private.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASViewConstraint.h"
+
+@class MASConstraintSignature;
+
+@interface MASViewConstraint ()
+
+/**
+ *	The view the layout constraint was added to, the closest common superview of both items
+ */
+@property (nonatomic, weak) MAS_VIEW *installedView;
+
+/**
+ *	The layout constraint created on install, owned by the layout engine while it is active
+ */
+@property (nonatomic, weak) MASLayoutConstraint *layoutConstraint;
+
+/**
+ *	The constant of the equation, setting it updates an installed layout constraint
+ */
+@property (nonatomic, assign) CGFloat layoutConstant;
+
+@property (nonatomic, strong) id mas_key;
+
+/**
+ *	The signature of the layout constraint install would create, computed without creating it
+ */
+@property (nonatomic, strong, readonly) MASConstraintSignature *layoutSignature;
+
+/**
+ *	Creates a constraint from a complete equation without going through the chaining DSL, eg to install a layout template
+ *
+ *	@param	secondViewAttribute	the second item and attribute, nil for a constant size
+ */
+- (id)initWithFirstViewAttribute:(MASViewAttribute *)firstViewAttribute
+                        relation:(NSLayoutRelation)relation
+             secondViewAttribute:(MASViewAttribute *)secondViewAttribute
+                      multiplier:(CGFloat)multiplier
+                        constant:(CGFloat)constant
+                        priority:(MASLayoutPriority)priority;
+
+/**
+ *	Replaces the installed constraints of a view with new ones.
+ *  Equivalent to uninstalling every installed constraint before installing the new ones,
+ *  but new constraints with the same signature as an installed one take over its layout constraint
+ *  and only update its constant, so only real additions and removals reach the layout engine.
+ *
+ *	@param	view	the view whose installed constraints are replaced
+ *	@param	constraints	the new MASViewConstraints, all with view as their first view
+ */
++ (void)remakeConstraintsOfView:(MAS_VIEW *)view withConstraints:(NSArray *)constraints;
+
+@end
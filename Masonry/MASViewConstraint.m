@@ -7,49 +7,40 @@
 //
 
 #import "MASViewConstraint.h"
+#import "MASViewConstraint+Private.h"
 #import "MASConstraint+Private.h"
 #import "MASCompositeConstraint.h"
 #import "MASLayoutConstraint.h"
+#import "MASConstraintSignature.h"
+#import "MASConstraintBatch.h"
+#import "MASViewRecord.h"
 #import "View+MASAdditions.h"
-#import <objc/runtime.h>
-
-@interface MAS_VIEW (MASConstraints)
-
-@property (nonatomic, readonly) NSMutableSet *mas_installedConstraints;
-
-@end
-
-@implementation MAS_VIEW (MASConstraints)
-
-static char kInstalledConstraintsKey;
-
-- (NSMutableSet *)mas_installedConstraints {
-    NSMutableSet *constraints = objc_getAssociatedObject(self, &kInstalledConstraintsKey);
-    if (!constraints) {
-        constraints = [NSMutableSet set];
-        objc_setAssociatedObject(self, &kInstalledConstraintsKey, constraints, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
-    }
-    return constraints;
-}
-
-@end
-
+#import "MASTrace+Private.h"
+#import "MASChurn+Private.h"
+#import "MASConstraintPool+Private.h"
 
 @interface MASViewConstraint ()
 
 @property (nonatomic, strong, readwrite) MASViewAttribute *secondViewAttribute;
-@property (nonatomic, weak) MAS_VIEW *installedView;
-@property (nonatomic, weak) MASLayoutConstraint *layoutConstraint;
 @property (nonatomic, assign) NSLayoutRelation layoutRelation;
 @property (nonatomic, assign) MASLayoutPriority layoutPriority;
 @property (nonatomic, assign) CGFloat layoutMultiplier;
-@property (nonatomic, assign) CGFloat layoutConstant;
 @property (nonatomic, assign) BOOL hasLayoutRelation;
-@property (nonatomic, strong) id mas_key;
 @property (nonatomic, assign) BOOL useAnimator;
 
 @end
 
+// identifies constraints that only differ in their constant, cheaper than a MASConstraintSignature
+static NSUInteger MASStructureHashOfLayoutConstraint(NSLayoutConstraint *layoutConstraint) {
+    NSUInteger hash = (NSUInteger)(__bridge void *)layoutConstraint.secondItem;
+    hash = hash * 31 + (NSUInteger)layoutConstraint.firstAttribute;
+    hash = hash * 31 + (NSUInteger)layoutConstraint.secondAttribute;
+    hash = hash * 31 + (NSUInteger)(layoutConstraint.relation + 1);
+    hash = hash * 31 + (NSUInteger)(layoutConstraint.multiplier * 1000);
+    hash = hash * 31 + (NSUInteger)layoutConstraint.priority;
+    return hash;
+}
+
 @implementation MASViewConstraint
 
 - (id)initWithFirstViewAttribute:(MASViewAttribute *)firstViewAttribute {
@@ -63,6 +54,24 @@ static char kInstalledConstraintsKey;
     return self;
 }
 
+- (id)initWithFirstViewAttribute:(MASViewAttribute *)firstViewAttribute
+                        relation:(NSLayoutRelation)relation
+             secondViewAttribute:(MASViewAttribute *)secondViewAttribute
+                      multiplier:(CGFloat)multiplier
+                        constant:(CGFloat)constant
+                        priority:(MASLayoutPriority)priority {
+    self = [self initWithFirstViewAttribute:firstViewAttribute];
+    if (!self) return nil;
+
+    _secondViewAttribute = secondViewAttribute;
+    self.layoutRelation = relation;
+    self.layoutMultiplier = multiplier;
+    self.layoutConstant = constant;
+    self.layoutPriority = priority;
+
+    return self;
+}
+
 #pragma mark - NSCoping
 
 - (id)copyWithZone:(NSZone __unused *)zone {
@@ -78,11 +87,107 @@ static char kInstalledConstraintsKey;
 #pragma mark - Public
 
 + (NSArray *)installedConstraintsForView:(MAS_VIEW *)view {
-    return [view.mas_installedConstraints allObjects];
+    // views Masonry never installed on have no record, answer without allocating one
+    return [MASViewRecord existingRecordForItem:view].installedConstraints ?: @[];
+}
+
++ (void)remakeConstraintsOfView:(MAS_VIEW *)view withConstraints:(NSArray *)constraints {
+    MASViewRecord *record = [MASViewRecord existingRecordForItem:view];
+    NSArray *installedConstraints = record.installedConstraints ?: @[];
+
+    // group the constraints that are still in the layout engine by their structure
+    NSMutableArray *obsoleteConstraints = [NSMutableArray array];
+    NSMutableDictionary *reusableConstraints = [NSMutableDictionary dictionaryWithCapacity:installedConstraints.count];
+    for (MASViewConstraint *constraint in installedConstraints) {
+        if (!constraint.hasBeenInstalled) {
+            [obsoleteConstraints addObject:constraint];
+            continue;
+        }
+        MASConstraintSignature *signature = [MASConstraintSignature signatureWithLayoutConstraint:constraint.layoutConstraint];
+        NSMutableArray *matches = reusableConstraints[signature];
+        if (!matches) {
+            matches = [NSMutableArray arrayWithCapacity:1];
+            reusableConstraints[signature] = matches;
+        }
+        [matches addObject:constraint];
+    }
+    [record removeAllInstalledConstraints];
+
+    // a new constraint with the same structure as an installed one takes over its layout constraint,
+    // duplicates are paired in installation order
+    for (MASViewConstraint *constraint in constraints) {
+        if (!reusableConstraints.count || constraint.hasBeenInstalled) continue;
+
+        MASConstraintSignature *signature = constraint.layoutSignature;
+        NSMutableArray *matches = reusableConstraints[signature];
+        if (!matches) continue;
+
+        [constraint adoptLayoutConstraintOfConstraint:matches.firstObject];
+        [matches removeObjectAtIndex:0];
+        if (!matches.count) {
+            [reusableConstraints removeObjectForKey:signature];
+        }
+    }
+    for (NSArray *matches in reusableConstraints.objectEnumerator) {
+        [obsoleteConstraints addObjectsFromArray:matches];
+    }
+
+    // only real removals and additions reach the layout engine
+    for (MASViewConstraint *constraint in obsoleteConstraints.reverseObjectEnumerator) {
+        [constraint uninstall];
+    }
+    for (MASViewConstraint *constraint in constraints) {
+        if (constraint.hasBeenInstalled) {
+            [[MASViewRecord recordForItem:constraint.firstViewAttribute.view] addInstalledConstraint:constraint];
+        } else {
+            constraint.updateExisting = NO;
+            [constraint install];
+        }
+    }
 }
 
 #pragma mark - Private
 
+- (void)adoptLayoutConstraintOfConstraint:(MASViewConstraint *)constraint {
+    MASLayoutConstraint *layoutConstraint = constraint.layoutConstraint;
+    self.installedView = constraint.installedView;
+    self.layoutConstraint = layoutConstraint;
+    layoutConstraint.mas_key = self.mas_key;
+    if (layoutConstraint.constant != self.layoutConstant) {
+        // patch the constant in place, the setter forwards to the layout constraint
+        self.layoutConstant = self.layoutConstant;
+    }
+    MASChurnRecordEvent(self.firstViewAttribute.view, MASChurnEventUpdatedInPlace);
+
+    // the previous handle no longer controls the layout constraint
+    constraint.layoutConstraint = nil;
+    constraint.installedView = nil;
+}
+
+- (MASConstraintSignature *)layoutSignature {
+    id secondLayoutItem = self.secondViewAttribute.item;
+    NSLayoutAttribute secondLayoutAttribute = self.secondViewAttribute.layoutAttribute;
+    [self resolveSecondLayoutItem:&secondLayoutItem attribute:&secondLayoutAttribute];
+
+    return [[MASConstraintSignature alloc] initWithFirstItem:self.firstViewAttribute.item
+                                              firstAttribute:self.firstViewAttribute.layoutAttribute
+                                                    relation:self.layoutRelation
+                                                  secondItem:secondLayoutItem
+                                             secondAttribute:secondLayoutAttribute
+                                                  multiplier:self.layoutMultiplier
+                                                    priority:self.layoutPriority];
+}
+
+- (void)resolveSecondLayoutItem:(id *)secondLayoutItem attribute:(NSLayoutAttribute *)secondLayoutAttribute {
+    // alignment attributes must have a secondViewAttribute
+    // therefore we assume that is refering to superview
+    // eg make.left.equalTo(@10)
+    if (!self.firstViewAttribute.isSizeAttribute && !self.secondViewAttribute) {
+        *secondLayoutItem = self.firstViewAttribute.view.superview;
+        *secondLayoutAttribute = self.firstViewAttribute.layoutAttribute;
+    }
+}
+
 - (void)setLayoutConstant:(CGFloat)layoutConstant {
     _layoutConstant = layoutConstant;
 
@@ -109,7 +214,7 @@ static char kInstalledConstraintsKey;
 - (BOOL)isActive {
     BOOL active = YES;
     if ([self supportsActiveProperty]) {
-        active = [self.layoutConstraint isActive];
+        active = [MASConstraintBatch isConstraintActive:self.layoutConstraint];
     }
 
     return active;
@@ -123,11 +228,11 @@ static char kInstalledConstraintsKey;
     if ([secondViewAttribute isKindOfClass:NSValue.class]) {
         [self setLayoutConstantWithValue:secondViewAttribute];
     } else if ([secondViewAttribute isKindOfClass:MAS_VIEW.class]) {
-        _secondViewAttribute = [[MASViewAttribute alloc] initWithView:secondViewAttribute layoutAttribute:self.firstViewAttribute.layoutAttribute];
+        _secondViewAttribute = [MASViewAttribute attributeWithView:secondViewAttribute layoutAttribute:self.firstViewAttribute.layoutAttribute];
     } else if ([secondViewAttribute isKindOfClass:MASViewAttribute.class]) {
         MASViewAttribute *attr = secondViewAttribute;
         if (attr.layoutAttribute == NSLayoutAttributeNotAnAttribute) {
-            _secondViewAttribute = [[MASViewAttribute alloc] initWithView:attr.view item:attr.item layoutAttribute:self.firstViewAttribute.layoutAttribute];;
+            _secondViewAttribute = [MASViewAttribute attributeWithView:attr.view item:attr.item layoutAttribute:self.firstViewAttribute.layoutAttribute];
         } else {
             _secondViewAttribute = secondViewAttribute;
         }
@@ -140,10 +245,7 @@ static char kInstalledConstraintsKey;
 
 - (MASConstraint * (^)(CGFloat))multipliedBy {
     return ^id(CGFloat multiplier) {
-        NSAssert(!self.hasBeenInstalled,
-                 @"Cannot modify constraint multiplier after it has been installed");
-        
-        self.layoutMultiplier = multiplier;
+        [self applyMultiplier:multiplier];
         return self;
     };
 }
@@ -151,26 +253,34 @@ static char kInstalledConstraintsKey;
 
 - (MASConstraint * (^)(CGFloat))dividedBy {
     return ^id(CGFloat divider) {
-        NSAssert(!self.hasBeenInstalled,
-                 @"Cannot modify constraint multiplier after it has been installed");
-
-        self.layoutMultiplier = 1.0/divider;
+        [self applyMultiplier:1.0/divider];
         return self;
     };
 }
 
+- (void)applyMultiplier:(CGFloat)multiplier {
+    NSAssert(!self.hasBeenInstalled,
+             @"Cannot modify constraint multiplier after it has been installed");
+
+    self.layoutMultiplier = multiplier;
+}
+
 #pragma mark - MASLayoutPriority proxy
 
 - (MASConstraint * (^)(MASLayoutPriority))priority {
     return ^id(MASLayoutPriority priority) {
-        NSAssert(!self.hasBeenInstalled,
-                 @"Cannot modify constraint priority after it has been installed");
-        
-        self.layoutPriority = priority;
+        [self applyPriority:priority];
         return self;
     };
 }
 
+- (void)applyPriority:(MASLayoutPriority)priority {
+    NSAssert(!self.hasBeenInstalled,
+             @"Cannot modify constraint priority after it has been installed");
+
+    self.layoutPriority = priority;
+}
+
 #pragma mark - NSLayoutRelation proxy
 
 - (MASConstraint * (^)(id, NSLayoutRelation))equalToWithRelation {
@@ -230,11 +340,20 @@ static char kInstalledConstraintsKey;
 
 - (MASConstraint * (^)(id))key {
     return ^id(id key) {
-        self.mas_key = key;
+        [self applyKey:key];
         return self;
     };
 }
 
+- (void)applyKey:(id)key {
+    id previousKey = self.mas_key;
+    self.mas_key = key;
+    if (self.hasBeenInstalled) {
+        self.layoutConstraint.mas_key = key;
+        [[MASViewRecord existingRecordForItem:self.firstViewAttribute.view] installedConstraint:self didChangeKeyFrom:previousKey];
+    }
+}
+
 #pragma mark - NSLayoutConstraint constant setters
 
 - (void)setInsets:(MASEdgeInsets)insets {
@@ -305,40 +424,60 @@ static char kInstalledConstraintsKey;
     [self uninstall];
 }
 
+- (void)addViewConstraintsToArray:(NSMutableArray *)viewConstraints {
+    [viewConstraints addObject:self];
+}
+
 - (void)install {
     if (self.hasBeenInstalled) {
         return;
     }
-    
+
+    MAS_TRACE_BEGIN(span, "MASViewConstraint install");
+    [self installLayoutConstraint];
+    MAS_TRACE_END(span, self.firstViewAttribute.view.mas_key, 1, self.updateExisting ? MASTraceModeUpdate : MASTraceModeMake);
+}
+
+- (void)installLayoutConstraint {
     if ([self supportsActiveProperty] && self.layoutConstraint) {
-        self.layoutConstraint.active = YES;
-        [self.firstViewAttribute.view.mas_installedConstraints addObject:self];
+        MASChurnRecordEvent(self.firstViewAttribute.view, MASChurnEventReactivated);
+        [self setLayoutConstraintActive:YES];
+        [self indexLayoutConstraint];
+        [[MASViewRecord recordForItem:self.firstViewAttribute.view] addInstalledConstraint:self];
+        [self noteLayoutChange];
         return;
     }
     
     MAS_VIEW *firstLayoutItem = self.firstViewAttribute.item;
     NSLayoutAttribute firstLayoutAttribute = self.firstViewAttribute.layoutAttribute;
-    MAS_VIEW *secondLayoutItem = self.secondViewAttribute.item;
+    id secondLayoutItem = self.secondViewAttribute.item;
     NSLayoutAttribute secondLayoutAttribute = self.secondViewAttribute.layoutAttribute;
-
-    // alignment attributes must have a secondViewAttribute
-    // therefore we assume that is refering to superview
-    // eg make.left.equalTo(@10)
-    if (!self.firstViewAttribute.isSizeAttribute && !self.secondViewAttribute) {
-        secondLayoutItem = self.firstViewAttribute.view.superview;
-        secondLayoutAttribute = firstLayoutAttribute;
+    [self resolveSecondLayoutItem:&secondLayoutItem attribute:&secondLayoutAttribute];
+
+    MASLayoutConstraint *layoutConstraint = nil;
+    // self.layoutConstraint is always nil here, ask the class whether recycled constraints can be reactivated
+    if (MASConstraintPoolEnabled && [MASLayoutConstraint instancesRespondToSelector:@selector(isActive)]) {
+        MASConstraintSignature *signature = [[MASConstraintSignature alloc] initWithFirstItem:firstLayoutItem
+                                                                               firstAttribute:firstLayoutAttribute
+                                                                                     relation:self.layoutRelation
+                                                                                   secondItem:secondLayoutItem
+                                                                              secondAttribute:secondLayoutAttribute
+                                                                                   multiplier:self.layoutMultiplier
+                                                                                     priority:self.layoutPriority];
+        layoutConstraint = MASConstraintPoolDequeue(self.firstViewAttribute.view, signature);
+        layoutConstraint.constant = self.layoutConstant;
+    }
+    BOOL recycled = layoutConstraint != nil;
+    if (!layoutConstraint) {
+        layoutConstraint = [MASLayoutConstraint constraintWithItem:firstLayoutItem
+                                                         attribute:firstLayoutAttribute
+                                                         relatedBy:self.layoutRelation
+                                                            toItem:secondLayoutItem
+                                                         attribute:secondLayoutAttribute
+                                                        multiplier:self.layoutMultiplier
+                                                          constant:self.layoutConstant];
+        layoutConstraint.priority = self.layoutPriority;
     }
-    
-    MASLayoutConstraint *layoutConstraint
-        = [MASLayoutConstraint constraintWithItem:firstLayoutItem
-                                        attribute:firstLayoutAttribute
-                                        relatedBy:self.layoutRelation
-                                           toItem:secondLayoutItem
-                                        attribute:secondLayoutAttribute
-                                       multiplier:self.layoutMultiplier
-                                         constant:self.layoutConstant];
-    
-    layoutConstraint.priority = self.layoutPriority;
     layoutConstraint.mas_key = self.mas_key;
     
     if (self.secondViewAttribute.view) {
@@ -362,45 +501,144 @@ static char kInstalledConstraintsKey;
         // just update the constant
         existingConstraint.constant = layoutConstraint.constant;
         self.layoutConstraint = existingConstraint;
+        MASChurnRecordEvent(self.firstViewAttribute.view, MASChurnEventUpdatedInPlace);
+        if (recycled) {
+            MASConstraintPoolEnqueue(self.firstViewAttribute.view, layoutConstraint);
+        }
     } else {
-        [self.installedView addConstraint:layoutConstraint];
+        MASConstraintBatch *batch = MASConstraintBatch.currentBatch;
+        if (batch) {
+            // the batch retains the constraint until it is committed,
+            // a recycled constraint whose deactivation is still queued simply stays active
+            [batch activateConstraint:layoutConstraint];
+        } else if (recycled) {
+            layoutConstraint.active = YES;
+        } else {
+            [self.installedView addConstraint:layoutConstraint];
+        }
         self.layoutConstraint = layoutConstraint;
-        [firstLayoutItem.mas_installedConstraints addObject:self];
+        [self indexLayoutConstraint];
+        [[MASViewRecord recordForItem:self.firstViewAttribute.view] addInstalledConstraint:self];
+        [self noteLayoutChange];
+        MASChurnRecordInstall(self.firstViewAttribute.view, MASStructureHashOfLayoutConstraint(layoutConstraint));
     }
 }
 
 - (MASLayoutConstraint *)layoutConstraintSimilarTo:(MASLayoutConstraint *)layoutConstraint {
+    MAS_TRACE_BEGIN(span, "layoutConstraintSimilarTo");
     // check if any constraints are the same apart from the only mutable property constant
 
-    // go through constraints in reverse as we do not want to match auto-resizing or interface builder constraints
-    // and they are likely to be added first.
-    for (NSLayoutConstraint *existingConstraint in self.installedView.constraints.reverseObjectEnumerator) {
-        if (![existingConstraint isKindOfClass:MASLayoutConstraint.class]) continue;
-        if (existingConstraint.firstItem != layoutConstraint.firstItem) continue;
-        if (existingConstraint.secondItem != layoutConstraint.secondItem) continue;
-        if (existingConstraint.firstAttribute != layoutConstraint.firstAttribute) continue;
-        if (existingConstraint.secondAttribute != layoutConstraint.secondAttribute) continue;
-        if (existingConstraint.relation != layoutConstraint.relation) continue;
-        if (existingConstraint.multiplier != layoutConstraint.multiplier) continue;
-        if (existingConstraint.priority != layoutConstraint.priority) continue;
-
-        return (id)existingConstraint;
+    // only constraints installed by Masonry are indexed, so auto-resizing or interface builder constraints
+    // are never matched. Prefer the most recently installed match.
+    MASConstraintSignature *signature = [MASConstraintSignature signatureWithLayoutConstraint:layoutConstraint];
+    NSMutableDictionary *index = [MASViewRecord existingRecordForItem:self.installedView].existingLayoutConstraintIndex;
+    NSPointerArray *matches = index[signature];
+    MASLayoutConstraint *similarConstraint = nil;
+    for (NSUInteger i = matches.count; i > 0; i--) {
+        MASLayoutConstraint *existingConstraint = [matches pointerAtIndex:i - 1];
+        if (!existingConstraint) {
+            [matches removePointerAtIndex:i - 1];
+            continue;
+        }
+        // items are compared by address, a key left by a deallocated view can match a new view at the same address
+        if (existingConstraint.firstItem != layoutConstraint.firstItem || existingConstraint.secondItem != layoutConstraint.secondItem) continue;
+        // constraints removed behind our back, eg by removeFromSuperview, are no longer active
+        if ([existingConstraint respondsToSelector:@selector(isActive)] && ![MASConstraintBatch isConstraintActive:existingConstraint]) continue;
+
+        similarConstraint = existingConstraint;
+        break;
+    }
+    if (matches && !matches.count) {
+        [index removeObjectForKey:signature];
+    }
+    MAS_TRACE_END(span, self.firstViewAttribute.view.mas_key, matches.count, MASTraceModeUpdate);
+    return similarConstraint;
+}
+
+- (void)setLayoutConstraintActive:(BOOL)active {
+    MASConstraintBatch *batch = MASConstraintBatch.currentBatch;
+    if (!batch) {
+        self.layoutConstraint.active = active;
+    } else if (active) {
+        [batch activateConstraint:self.layoutConstraint];
+    } else {
+        [batch deactivateConstraint:self.layoutConstraint];
+    }
+}
+
+- (void)noteLayoutChange {
+    [[MASViewRecord existingRecordForItem:self.firstViewAttribute.view] noteLayoutChange];
+}
+
+#pragma mark - constraint index
+
+- (void)indexLayoutConstraint {
+    MASLayoutConstraint *layoutConstraint = self.layoutConstraint;
+    if (!layoutConstraint || !self.installedView) return;
+
+    MASConstraintSignature *signature = [MASConstraintSignature signatureWithLayoutConstraint:layoutConstraint];
+    MASViewRecord *record = [MASViewRecord recordForItem:self.installedView];
+    NSMutableDictionary *index = record.layoutConstraintIndex;
+    NSPointerArray *matches = index[signature];
+    if (!matches) {
+        [record pruneLayoutConstraintIndexIfNeeded];
+        matches = [NSPointerArray weakObjectsPointerArray];
+        index[signature] = matches;
+    }
+    for (NSUInteger i = 0; i < matches.count; i++) {
+        if ([matches pointerAtIndex:i] == (__bridge void *)layoutConstraint) return;
+    }
+    [matches addPointer:(__bridge void *)layoutConstraint];
+}
+
+- (void)unindexLayoutConstraint {
+    MASLayoutConstraint *layoutConstraint = self.layoutConstraint;
+    if (!layoutConstraint || !self.installedView) return;
+
+    MASConstraintSignature *signature = [MASConstraintSignature signatureWithLayoutConstraint:layoutConstraint];
+    NSMutableDictionary *index = [MASViewRecord existingRecordForItem:self.installedView].existingLayoutConstraintIndex;
+    if (!index) return;
+    NSPointerArray *matches = index[signature];
+    for (NSUInteger i = matches.count; i > 0; i--) {
+        void *pointer = [matches pointerAtIndex:i - 1];
+        if (!pointer || pointer == (__bridge void *)layoutConstraint) {
+            [matches removePointerAtIndex:i - 1];
+        }
+    }
+    if (matches && matches.count == 0) {
+        [index removeObjectForKey:signature];
     }
-    return nil;
 }
 
 - (void)uninstall {
+    MAS_TRACE_BEGIN(span, "MASViewConstraint uninstall");
+    [self uninstallLayoutConstraint];
+    MAS_TRACE_END(span, self.firstViewAttribute.view.mas_key, 1, MASTraceModeNone);
+}
+
+- (void)uninstallLayoutConstraint {
+    if (self.layoutConstraint) {
+        MASChurnRecordUninstall(self.firstViewAttribute.view, MASStructureHashOfLayoutConstraint(self.layoutConstraint));
+    }
+    [self noteLayoutChange];
     if ([self supportsActiveProperty]) {
-        self.layoutConstraint.active = NO;
-        [self.firstViewAttribute.view.mas_installedConstraints removeObject:self];
+        [self setLayoutConstraintActive:NO];
+        [self unindexLayoutConstraint];
+        [[MASViewRecord existingRecordForItem:self.firstViewAttribute.view] removeInstalledConstraint:self];
+        if (MASConstraintPoolEnqueue(self.firstViewAttribute.view, self.layoutConstraint)) {
+            // the pool owns the layout constraint now, installing again takes whichever one matches
+            self.layoutConstraint = nil;
+            self.installedView = nil;
+        }
         return;
     }
     
+    [self unindexLayoutConstraint];
     [self.installedView removeConstraint:self.layoutConstraint];
     self.layoutConstraint = nil;
     self.installedView = nil;
     
-    [self.firstViewAttribute.view.mas_installedConstraints removeObject:self];
+    [[MASViewRecord existingRecordForItem:self.firstViewAttribute.view] removeInstalledConstraint:self];
 }
 
 @end
@@ -0,0 +1,149 @@
+//
+//  MASViewRecord.h
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASUtilities.h"
+#import "MASChurn.h"
+
+@class MASViewAttribute;
+@class MASViewConstraint;
+
+// one more than the largest NSLayoutAttribute Masonry creates attributes for
+#define MAS_VIEW_RECORD_ATTRIBUTE_COUNT 32
+
+// structures of removed constraints remembered to recognise them being installed again
+#define MAS_VIEW_RECORD_RECENT_UNINSTALL_COUNT 8
+
+@class MASViewRecord;
+
+/**
+ *  Told when the constraints of a view record change structurally, see -[MASViewRecord addLayoutObserver:]
+ */
+@protocol MASViewRecordLayoutObserver <NSObject>
+
+- (void)viewRecordDidChangeLayout:(MASViewRecord *)record;
+
+@end
+
+/**
+ *  Everything Masonry keeps about a single view, stored in one associated object
+ *  so that each view costs a single lookup.
+ *
+ *  Layout guides also get a record, which only ever holds their interned attributes.
+ */
+@interface MASViewRecord : NSObject {
+    @public
+    /**
+     *  Interned attributes of the item indexed by NSLayoutAttribute, see +[MASViewAttribute attributeWithView:item:layoutAttribute:]
+     */
+    __strong MASViewAttribute *_attributes[MAS_VIEW_RECORD_ATTRIBUTE_COUNT];
+
+    /**
+     *  Churn counters and thrash detection state, see MASChurn
+     */
+    MASChurnCounts _churnCounts;
+    NSUInteger _recentlyUninstalledStructures[MAS_VIEW_RECORD_RECENT_UNINSTALL_COUNT];
+    CFAbsoluteTime _recentlyUninstalledTimes[MAS_VIEW_RECORD_RECENT_UNINSTALL_COUNT];
+    NSUInteger _nextRecentlyUninstalledIndex;
+    CFAbsoluteTime _thrashWindowStart;
+    NSUInteger _thrashWindowPasses;
+
+    /**
+     *  Uninstalled layout constraints of the view kept for reuse keyed by MASConstraintSignature, see MASConstraintPool
+     */
+    NSMutableDictionary *_recycledLayoutConstraints;
+    NSUInteger _recycledLayoutConstraintCount;
+}
+
+/**
+ *	Returns the record of an item without creating one
+ *
+ *	@return	the existing record or nil if Masonry never touched the item
+ */
++ (instancetype)existingRecordForItem:(id)item;
+
+/**
+ *	Returns the record of an item, creating it on first use
+ */
++ (instancetype)recordForItem:(id)item;
+
+/**
+ *  The key used to identify the view in debug output, see mas_key
+ */
+@property (nonatomic, strong) id key;
+
+/**
+ *  Masonry constraints whose first item is this view, in installation order
+ */
+@property (nonatomic, copy, readonly) NSArray *installedConstraints;
+
+/**
+ *  Number of installed constraints, answered without copying
+ */
+@property (nonatomic, assign, readonly) NSUInteger installedConstraintCount;
+
+/**
+ *  Masonry layout constraints installed on this view keyed by MASConstraintSignature.
+ *  Each signature maps to a weak NSPointerArray ordered by installation, so the most recently installed match is last.
+ *  Signatures do not retain their items, so a key can outlive the views it describes until the next prune,
+ *  matches must be checked against the items they are looked up for.
+ *  Created lazily, use existingLayoutConstraintIndex for lookups that should not allocate
+ */
+@property (nonatomic, strong, readonly) NSMutableDictionary *layoutConstraintIndex;
+@property (nonatomic, strong, readonly) NSMutableDictionary *existingLayoutConstraintIndex;
+
+/**
+ *	Drops index entries whose layout constraints have all been deallocated, eg after subviews were removed without uninstalling.
+ *  Only sweeps once the index has doubled since the last sweep, call before adding a new signature
+ */
+- (void)pruneLayoutConstraintIndexIfNeeded;
+
+/**
+ *  Incremented whenever a Masonry layout constraint of this view is installed or uninstalled,
+ *  so cached layout results can tell that the view's layout changed. Constant changes leave it alone.
+ *  Safe to read from any thread.
+ */
+@property (atomic, assign, readonly) NSUInteger layoutGeneration;
+
+/**
+ *	Increments layoutGeneration and tells the layout observers
+ */
+- (void)noteLayoutChange;
+
+/**
+ *	Tells an observer about every later noteLayoutChange, observers are held weakly. Main thread only
+ */
+- (void)addLayoutObserver:(id<MASViewRecordLayoutObserver>)observer;
+
+/**
+ *	Appends a constraint to the installed constraints, constraints are expected to be added once
+ */
+- (void)addInstalledConstraint:(MASViewConstraint *)constraint;
+
+/**
+ *	Removes a constraint from the installed constraints.
+ *  Searches from the most recently installed, so uninstalling in reverse order is O(1) per constraint
+ */
+- (void)removeInstalledConstraint:(MASViewConstraint *)constraint;
+
+/**
+ *	Forgets every installed constraint without uninstalling them
+ */
+- (void)removeAllInstalledConstraints;
+
+/**
+ *	The installed constraint with a mas_key, the most recently installed one if several share the key.
+ *  Keys must conform to NSCopying to be looked up
+ */
+- (MASViewConstraint *)installedConstraintForKey:(id)key;
+
+/**
+ *	Moves an installed constraint to its new mas_key
+ */
+- (void)installedConstraint:(MASViewConstraint *)constraint didChangeKeyFrom:(id)previousKey;
+
+@end
@@ -0,0 +1,166 @@
+//
+//  MASViewRecord.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASViewRecord.h"
+#import "MASViewConstraint+Private.h"
+#import <objc/runtime.h>
+
+@interface MASViewRecord ()
+
+@property (nonatomic, strong) NSMutableArray *mutableInstalledConstraints;
+@property (nonatomic, strong) NSMutableDictionary *keyedConstraints;
+@property (nonatomic, strong, readwrite) NSMutableDictionary *layoutConstraintIndex;
+@property (atomic, assign, readwrite) NSUInteger layoutGeneration;
+@property (nonatomic, strong) NSHashTable *layoutObservers;
+
+@end
+
+@implementation MASViewRecord {
+    NSUInteger _layoutConstraintIndexPruneCount;
+}
+
+static char kViewRecordKey;
+
++ (instancetype)existingRecordForItem:(id)item {
+    if (!item) return nil;
+    return objc_getAssociatedObject(item, &kViewRecordKey);
+}
+
++ (instancetype)recordForItem:(id)item {
+    if (!item) return nil;
+    MASViewRecord *record = objc_getAssociatedObject(item, &kViewRecordKey);
+    if (!record) {
+        record = [[MASViewRecord alloc] init];
+        objc_setAssociatedObject(item, &kViewRecordKey, record, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    return record;
+}
+
+#pragma mark - installed constraints
+
+- (void)noteLayoutChange {
+    // only ever written on the main thread
+    self.layoutGeneration++;
+    for (id<MASViewRecordLayoutObserver> observer in self.layoutObservers) {
+        [observer viewRecordDidChangeLayout:self];
+    }
+}
+
+- (void)addLayoutObserver:(id<MASViewRecordLayoutObserver>)observer {
+    if (!self.layoutObservers) {
+        self.layoutObservers = [NSHashTable weakObjectsHashTable];
+    }
+    [self.layoutObservers addObject:observer];
+}
+
+- (NSArray *)installedConstraints {
+    return self.mutableInstalledConstraints.copy ?: @[];
+}
+
+- (NSUInteger)installedConstraintCount {
+    return self.mutableInstalledConstraints.count;
+}
+
+- (void)addInstalledConstraint:(MASViewConstraint *)constraint {
+    if (!self.mutableInstalledConstraints) {
+        self.mutableInstalledConstraints = [NSMutableArray array];
+    }
+    [self.mutableInstalledConstraints addObject:constraint];
+    [self addKeyOfConstraint:constraint];
+}
+
+- (void)removeInstalledConstraint:(MASViewConstraint *)constraint {
+    NSMutableArray *constraints = self.mutableInstalledConstraints;
+    for (NSUInteger i = constraints.count; i > 0; i--) {
+        if (constraints[i - 1] == constraint) {
+            [constraints removeObjectAtIndex:i - 1];
+            [self removeKey:constraint.mas_key ofConstraint:constraint];
+            return;
+        }
+    }
+}
+
+- (void)removeAllInstalledConstraints {
+    [self.mutableInstalledConstraints removeAllObjects];
+    [self.keyedConstraints removeAllObjects];
+}
+
+#pragma mark - keyed constraints
+
+static BOOL MASViewRecordIsKey(id key) {
+    return key && [key conformsToProtocol:@protocol(NSCopying)];
+}
+
+- (MASViewConstraint *)installedConstraintForKey:(id)key {
+    return MASViewRecordIsKey(key) ? self.keyedConstraints[key] : nil;
+}
+
+- (void)installedConstraint:(MASViewConstraint *)constraint didChangeKeyFrom:(id)previousKey {
+    [self removeKey:previousKey ofConstraint:constraint];
+    [self addKeyOfConstraint:constraint];
+}
+
+- (void)addKeyOfConstraint:(MASViewConstraint *)constraint {
+    id key = constraint.mas_key;
+    if (!MASViewRecordIsKey(key)) return;
+    if (!self.keyedConstraints) {
+        self.keyedConstraints = [NSMutableDictionary dictionary];
+    }
+    self.keyedConstraints[key] = constraint;
+}
+
+- (void)removeKey:(id)key ofConstraint:(MASViewConstraint *)constraint {
+    if (!MASViewRecordIsKey(key) || self.keyedConstraints[key] != constraint) return;
+    [self.keyedConstraints removeObjectForKey:key];
+
+    // fall back to the previous installed constraint sharing the key
+    NSArray *constraints = self.mutableInstalledConstraints;
+    for (NSUInteger i = constraints.count; i > 0; i--) {
+        MASViewConstraint *installedConstraint = constraints[i - 1];
+        if (installedConstraint != constraint && [installedConstraint.mas_key isEqual:key]) {
+            self.keyedConstraints[key] = installedConstraint;
+            return;
+        }
+    }
+}
+
+#pragma mark - constraint index
+
+- (NSMutableDictionary *)layoutConstraintIndex {
+    if (!_layoutConstraintIndex) {
+        _layoutConstraintIndex = [NSMutableDictionary dictionary];
+    }
+    return _layoutConstraintIndex;
+}
+
+- (NSMutableDictionary *)existingLayoutConstraintIndex {
+    return _layoutConstraintIndex;
+}
+
+- (void)pruneLayoutConstraintIndexIfNeeded {
+    NSMutableDictionary *index = _layoutConstraintIndex;
+    if (index.count < _layoutConstraintIndexPruneCount) return;
+
+    // constraints of removed subviews go away without being uninstalled, their keys would pile up in long lived containers
+    NSMutableArray *deadSignatures = [NSMutableArray array];
+    [index enumerateKeysAndObjectsUsingBlock:^(id signature, NSPointerArray *matches, BOOL __unused *stop) {
+        for (NSUInteger i = matches.count; i > 0; i--) {
+            if (![matches pointerAtIndex:i - 1]) {
+                [matches removePointerAtIndex:i - 1];
+            }
+        }
+        if (!matches.count) {
+            [deadSignatures addObject:signature];
+        }
+    }];
+    [index removeObjectsForKeys:deadSignatures];
+    // sweeping again only once the index has doubled keeps pruning amortized constant per indexed constraint
+    _layoutConstraintIndexPruneCount = MAX(index.count * 2, 16);
+}
+
+@end
@@ -25,5 +25,20 @@ FOUNDATION_EXPORT const unsigned char MasonryVersionString[];
 #import "MASViewAttribute.h"
 #import "MASViewConstraint.h"
 #import "MASConstraintMaker.h"
+#import "MASConstraintBatch.h"
+#import "MASLayoutTemplate.h"
+#import "MASLayoutTemplateBuilder.h"
+#import "MASLayoutTemplate+MASSerialization.h"
+#import "MASLayoutSolver.h"
+#import "MASLayoutTree.h"
+#import "MASHeadlessLayout.h"
+#import "MASSizeCache.h"
+#import "MASTrace.h"
+#import "MASChurn.h"
+#import "MASDistribution.h"
+#import "MASStack.h"
+#import "MASConstraintPool.h"
+#import "MASConstraintAnimator.h"
+#import "MASLayoutTransaction.h"
 #import "MASLayoutConstraint.h"
 #import "NSLayoutConstraint+MASDebugAdditions.h"
@@ -10,6 +10,8 @@
 #import "MASConstraintMaker.h"
 #import "MASViewAttribute.h"
 
+@class MASDistribution;
+
 typedef NS_ENUM(NSUInteger, MASAxisType) {
     MASAxisTypeHorizontal,
     MASAxisTypeVertical
@@ -56,8 +58,10 @@ typedef NS_ENUM(NSUInteger, MASAxisType) {
  *  @param fixedSpacing the spacing between each item
  *  @param leadSpacing  the spacing before the first item and the container
  *  @param tailSpacing  the spacing after the last item and the container
+ *
+ *  @return the distribution, whose spacings can be changed without recreating its constraints
  */
-- (void)mas_distributeViewsAlongAxis:(MASAxisType)axisType withFixedSpacing:(CGFloat)fixedSpacing leadSpacing:(CGFloat)leadSpacing tailSpacing:(CGFloat)tailSpacing;
+- (MASDistribution *)mas_distributeViewsAlongAxis:(MASAxisType)axisType withFixedSpacing:(CGFloat)fixedSpacing leadSpacing:(CGFloat)leadSpacing tailSpacing:(CGFloat)tailSpacing;
 
 /**
  *  distribute with fixed item size
@@ -66,7 +70,9 @@ typedef NS_ENUM(NSUInteger, MASAxisType) {
  *  @param fixedItemLength the fixed length of each item
  *  @param leadSpacing     the spacing before the first item and the container
  *  @param tailSpacing     the spacing after the last item and the container
+ *
+ *  @return the distribution, whose item length and spacings can be changed without recreating its constraints
  */
-- (void)mas_distributeViewsAlongAxis:(MASAxisType)axisType withFixedItemLength:(CGFloat)fixedItemLength leadSpacing:(CGFloat)leadSpacing tailSpacing:(CGFloat)tailSpacing;
+- (MASDistribution *)mas_distributeViewsAlongAxis:(MASAxisType)axisType withFixedItemLength:(CGFloat)fixedItemLength leadSpacing:(CGFloat)leadSpacing tailSpacing:(CGFloat)tailSpacing;
 
 @end
@@ -74,6 +74,15 @@
  */
 - (instancetype)mas_closestCommonSuperview:(MAS_VIEW *)view;
 
+/**
+ *  Memoizes mas_closestCommonSuperview: for the duration of the block,
+ *  so each distinct pair of views only walks the hierarchy once.
+ *  The view hierarchy must not change while the block is executing.
+ *
+ *  @param block scope within which common superviews are cached, calls can be nested
+ */
++ (void)mas_performWithCommonSuperviewCache:(void(NS_NOESCAPE ^)(void))block;
+
 /**
  *  Creates a MASConstraintMaker with the callee view.
  *  Any constraints defined are added to the view or the appropriate superview once the block has finished executing
@@ -106,4 +115,32 @@
  */
 - (NSArray *)mas_remakeConstraints:(void(NS_NOESCAPE ^)(MASConstraintMaker *make))block;
 
+/**
+ *  Finds an installed constraint of the view by the key it was given with MASConstraint key,
+ *  without a maker or a search. The children of a keyed composite are keyed by their index, eg @"edges[0]".
+ *  The most recently installed constraint wins if several share a key
+ *
+ *  @param key the key of the constraint, must conform to NSCopying
+ *
+ *  @return the MASConstraint or nil if no installed constraint of the view has the key
+ */
+- (MASConstraint *)mas_constraintForKey:(id)key;
+
+/**
+ *  Sets the constant of a keyed installed constraint in place, skipping the maker and the search for a similar constraint.
+ *
+ *  @return NO if no installed constraint of the view has the key
+ */
+- (BOOL)mas_setConstant:(CGFloat)constant forKey:(id)key;
+
+/**
+ *  Sets the constants of several keyed installed constraints in one call.
+ *  Only constants that changed reach the layout engine, which picks them all up in its next layout pass.
+ *
+ *  @param constants NSNumber constants keyed by constraint key
+ *
+ *  @return the number of keys an installed constraint was found for
+ */
+- (NSUInteger)mas_setConstants:(NSDictionary *)constants;
+
 @end
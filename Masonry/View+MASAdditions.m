@@ -7,169 +7,212 @@
 //
 
 #import "View+MASAdditions.h"
-#import <objc/runtime.h>
+#import "MASViewRecord.h"
+#import "MASViewConstraint+Private.h"
+#import "MASTrace+Private.h"
 
 @implementation MAS_VIEW (MASAdditions)
 
 - (NSArray *)mas_makeConstraints:(void(NS_NOESCAPE ^)(MASConstraintMaker *))block {
+    MAS_TRACE_BEGIN(span, "mas_makeConstraints");
     self.translatesAutoresizingMaskIntoConstraints = NO;
     MASConstraintMaker *constraintMaker = [[MASConstraintMaker alloc] initWithView:self];
     block(constraintMaker);
-    return [constraintMaker install];
+    NSArray *constraints = [constraintMaker install];
+    MAS_TRACE_END(span, self.mas_key, constraints.count, MASTraceModeMake);
+    return constraints;
 }
 
 - (NSArray *)mas_updateConstraints:(void(NS_NOESCAPE ^)(MASConstraintMaker *))block {
+    MAS_TRACE_BEGIN(span, "mas_updateConstraints");
     self.translatesAutoresizingMaskIntoConstraints = NO;
     MASConstraintMaker *constraintMaker = [[MASConstraintMaker alloc] initWithView:self];
     constraintMaker.updateExisting = YES;
     block(constraintMaker);
-    return [constraintMaker install];
+    NSArray *constraints = [constraintMaker install];
+    MAS_TRACE_END(span, self.mas_key, constraints.count, MASTraceModeUpdate);
+    return constraints;
 }
 
 - (NSArray *)mas_remakeConstraints:(void(NS_NOESCAPE ^)(MASConstraintMaker *make))block {
+    MAS_TRACE_BEGIN(span, "mas_remakeConstraints");
     self.translatesAutoresizingMaskIntoConstraints = NO;
     MASConstraintMaker *constraintMaker = [[MASConstraintMaker alloc] initWithView:self];
     constraintMaker.removeExisting = YES;
     block(constraintMaker);
-    return [constraintMaker install];
+    NSArray *constraints = [constraintMaker install];
+    MAS_TRACE_END(span, self.mas_key, constraints.count, MASTraceModeRemake);
+    return constraints;
+}
+
+#pragma mark - keyed constraints
+
+- (MASConstraint *)mas_constraintForKey:(id)key {
+    return [[MASViewRecord existingRecordForItem:self] installedConstraintForKey:key];
+}
+
+- (BOOL)mas_setConstant:(CGFloat)constant forKey:(id)key {
+    MASViewConstraint *constraint = [[MASViewRecord existingRecordForItem:self] installedConstraintForKey:key];
+    if (!constraint) return NO;
+    if (constraint.layoutConstant != constant) {
+        constraint.layoutConstant = constant;
+    }
+    return YES;
+}
+
+- (NSUInteger)mas_setConstants:(NSDictionary *)constants {
+    MAS_TRACE_BEGIN(span, "mas_setConstants");
+    MASViewRecord *record = [MASViewRecord existingRecordForItem:self];
+    __block NSUInteger count = 0;
+    [constants enumerateKeysAndObjectsUsingBlock:^(id key, NSNumber *constant, BOOL *stop) {
+        MASViewConstraint *constraint = [record installedConstraintForKey:key];
+        if (!constraint) return;
+        count++;
+        CGFloat value = (CGFloat)constant.doubleValue;
+        if (constraint.layoutConstant != value) {
+            constraint.layoutConstant = value;
+        }
+    }];
+    MAS_TRACE_END(span, self.mas_key, count, MASTraceModeUpdate);
+    return count;
 }
 
 #pragma mark - NSLayoutAttribute properties
 
 - (MASViewAttribute *)mas_left {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeLeft];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeLeft];
 }
 
 - (MASViewAttribute *)mas_top {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeTop];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeTop];
 }
 
 - (MASViewAttribute *)mas_right {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeRight];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeRight];
 }
 
 - (MASViewAttribute *)mas_bottom {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeBottom];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeBottom];
 }
 
 - (MASViewAttribute *)mas_leading {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeLeading];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeLeading];
 }
 
 - (MASViewAttribute *)mas_trailing {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeTrailing];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeTrailing];
 }
 
 - (MASViewAttribute *)mas_width {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeWidth];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeWidth];
 }
 
 - (MASViewAttribute *)mas_height {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeHeight];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeHeight];
 }
 
 - (MASViewAttribute *)mas_centerX {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeCenterX];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeCenterX];
 }
 
 - (MASViewAttribute *)mas_centerY {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeCenterY];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeCenterY];
 }
 
 - (MASViewAttribute *)mas_baseline {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeBaseline];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeBaseline];
 }
 
 - (MASViewAttribute *(^)(NSLayoutAttribute))mas_attribute
 {
     return ^(NSLayoutAttribute attr) {
-        return [[MASViewAttribute alloc] initWithView:self layoutAttribute:attr];
+        return [MASViewAttribute attributeWithView:self layoutAttribute:attr];
     };
 }
 
 - (MASViewAttribute *)mas_firstBaseline {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeFirstBaseline];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeFirstBaseline];
 }
 - (MASViewAttribute *)mas_lastBaseline {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeLastBaseline];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeLastBaseline];
 }
 
 #if TARGET_OS_IPHONE || TARGET_OS_TV
 
 - (MASViewAttribute *)mas_leftMargin {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeLeftMargin];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeLeftMargin];
 }
 
 - (MASViewAttribute *)mas_rightMargin {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeRightMargin];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeRightMargin];
 }
 
 - (MASViewAttribute *)mas_topMargin {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeTopMargin];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeTopMargin];
 }
 
 - (MASViewAttribute *)mas_bottomMargin {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeBottomMargin];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeBottomMargin];
 }
 
 - (MASViewAttribute *)mas_leadingMargin {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeLeadingMargin];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeLeadingMargin];
 }
 
 - (MASViewAttribute *)mas_trailingMargin {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeTrailingMargin];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeTrailingMargin];
 }
 
 - (MASViewAttribute *)mas_centerXWithinMargins {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeCenterXWithinMargins];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeCenterXWithinMargins];
 }
 
 - (MASViewAttribute *)mas_centerYWithinMargins {
-    return [[MASViewAttribute alloc] initWithView:self layoutAttribute:NSLayoutAttributeCenterYWithinMargins];
+    return [MASViewAttribute attributeWithView:self layoutAttribute:NSLayoutAttributeCenterYWithinMargins];
 }
 
 - (MASViewAttribute *)mas_safeAreaLayoutGuide {
-    return [[MASViewAttribute alloc] initWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeNotAnAttribute];
+    return [MASViewAttribute attributeWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeNotAnAttribute];
 }
 
 - (MASViewAttribute *)mas_safeAreaLayoutGuideLeading {
-    return [[MASViewAttribute alloc] initWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeLeading];
+    return [MASViewAttribute attributeWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeLeading];
 }
 
 - (MASViewAttribute *)mas_safeAreaLayoutGuideTrailing {
-    return [[MASViewAttribute alloc] initWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeTrailing];
+    return [MASViewAttribute attributeWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeTrailing];
 }
 
 - (MASViewAttribute *)mas_safeAreaLayoutGuideLeft {
-    return [[MASViewAttribute alloc] initWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeLeft];
+    return [MASViewAttribute attributeWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeLeft];
 }
 
 - (MASViewAttribute *)mas_safeAreaLayoutGuideRight {
-    return [[MASViewAttribute alloc] initWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeRight];
+    return [MASViewAttribute attributeWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeRight];
 }
 
 - (MASViewAttribute *)mas_safeAreaLayoutGuideTop {
-    return [[MASViewAttribute alloc] initWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeTop];
+    return [MASViewAttribute attributeWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeTop];
 }
 
 - (MASViewAttribute *)mas_safeAreaLayoutGuideBottom {
-    return [[MASViewAttribute alloc] initWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeBottom];
+    return [MASViewAttribute attributeWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeBottom];
 }
 
 - (MASViewAttribute *)mas_safeAreaLayoutGuideWidth {
-    return [[MASViewAttribute alloc] initWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeWidth];
+    return [MASViewAttribute attributeWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeWidth];
 }
 
 - (MASViewAttribute *)mas_safeAreaLayoutGuideHeight {
-    return [[MASViewAttribute alloc] initWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeHeight];
+    return [MASViewAttribute attributeWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeHeight];
 }
 
 - (MASViewAttribute *)mas_safeAreaLayoutGuideCenterX {
-    return [[MASViewAttribute alloc] initWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeCenterX];
+    return [MASViewAttribute attributeWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeCenterX];
 }
 
 - (MASViewAttribute *)mas_safeAreaLayoutGuideCenterY {
-    return [[MASViewAttribute alloc] initWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeCenterY];
+    return [MASViewAttribute attributeWithView:self item:self.safeAreaLayoutGuide layoutAttribute:NSLayoutAttributeCenterY];
 }
 
 #endif
@@ -177,30 +220,83 @@
 #pragma mark - associated properties
 
 - (id)mas_key {
-    return objc_getAssociatedObject(self, @selector(mas_key));
+    return [MASViewRecord existingRecordForItem:self].key;
 }
 
 - (void)setMas_key:(id)key {
-    objc_setAssociatedObject(self, @selector(mas_key), key, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    if (!key && ![MASViewRecord existingRecordForItem:self]) return;
+    [MASViewRecord recordForItem:self].key = key;
 }
 
 #pragma mark - heirachy
 
+static NSMapTable *MASCommonSuperviewCache = nil;
+static NSUInteger MASCommonSuperviewCacheDepth = 0;
+
++ (void)mas_performWithCommonSuperviewCache:(void(NS_NOESCAPE ^)(void))block {
+    if (MASCommonSuperviewCacheDepth++ == 0) {
+        MASCommonSuperviewCache = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality
+                                                        valueOptions:NSPointerFunctionsStrongMemory];
+    }
+    @try {
+        block();
+    } @finally {
+        if (--MASCommonSuperviewCacheDepth == 0) {
+            MASCommonSuperviewCache = nil;
+        }
+    }
+}
+
 - (instancetype)mas_closestCommonSuperview:(MAS_VIEW *)view {
-    MAS_VIEW *closestCommonSuperview = nil;
+    if (!view) return nil;
+    if (view == self) return self;
+
+    NSMapTable *cache = MASCommonSuperviewCache;
+    if (!cache) {
+        MAS_TRACE_BEGIN(span, "mas_closestCommonSuperview");
+        MAS_VIEW *closestCommonSuperview = [self mas_resolveClosestCommonSuperview:view];
+        MAS_TRACE_END(span, self.mas_key, 0, MASTraceModeNone);
+        return closestCommonSuperview;
+    }
 
+    // the pair is unordered, always key by the lower address first
+    MAS_VIEW *first = self, *second = view;
+    if ((__bridge void *)first > (__bridge void *)second) {
+        first = view;
+        second = self;
+    }
+    NSMapTable *secondViews = [cache objectForKey:first];
+    if (!secondViews) {
+        secondViews = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality
+                                            valueOptions:NSPointerFunctionsStrongMemory];
+        [cache setObject:secondViews forKey:first];
+    }
+    id closestCommonSuperview = [secondViews objectForKey:second];
+    if (!closestCommonSuperview) {
+        MAS_TRACE_BEGIN(span, "mas_closestCommonSuperview");
+        closestCommonSuperview = [first mas_resolveClosestCommonSuperview:second] ?: NSNull.null;
+        [secondViews setObject:closestCommonSuperview forKey:second];
+        MAS_TRACE_END(span, self.mas_key, 0, MASTraceModeNone);
+    }
+    return closestCommonSuperview == NSNull.null ? nil : closestCommonSuperview;
+}
+
+- (instancetype)mas_resolveClosestCommonSuperview:(MAS_VIEW *)view {
+    // bring both views to the same depth, then walk up in lockstep until they meet
+    NSUInteger firstDepth = 0, secondDepth = 0;
+    for (MAS_VIEW *superview = self.superview; superview; superview = superview.superview) firstDepth++;
+    for (MAS_VIEW *superview = view.superview; superview; superview = superview.superview) secondDepth++;
+
+    MAS_VIEW *firstViewSuperview = self;
     MAS_VIEW *secondViewSuperview = view;
-    while (!closestCommonSuperview && secondViewSuperview) {
-        MAS_VIEW *firstViewSuperview = self;
-        while (!closestCommonSuperview && firstViewSuperview) {
-            if (secondViewSuperview == firstViewSuperview) {
-                closestCommonSuperview = secondViewSuperview;
-            }
-            firstViewSuperview = firstViewSuperview.superview;
-        }
+    for (; firstDepth > secondDepth; firstDepth--) firstViewSuperview = firstViewSuperview.superview;
+    for (; secondDepth > firstDepth; secondDepth--) secondViewSuperview = secondViewSuperview.superview;
+
+    while (firstViewSuperview != secondViewSuperview) {
+        firstViewSuperview = firstViewSuperview.superview;
         secondViewSuperview = secondViewSuperview.superview;
     }
-    return closestCommonSuperview;
+    return firstViewSuperview;
 }
 
 @end
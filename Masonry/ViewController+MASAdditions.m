@@ -16,23 +16,23 @@
 #pragma clang diagnostic ignored "-Wdeprecated-declarations"
 
 - (MASViewAttribute *)mas_topLayoutGuide {
-    return [[MASViewAttribute alloc] initWithView:self.view item:self.topLayoutGuide layoutAttribute:NSLayoutAttributeBottom];
+    return [MASViewAttribute attributeWithView:self.view item:self.topLayoutGuide layoutAttribute:NSLayoutAttributeBottom];
 }
 - (MASViewAttribute *)mas_topLayoutGuideTop {
-    return [[MASViewAttribute alloc] initWithView:self.view item:self.topLayoutGuide layoutAttribute:NSLayoutAttributeTop];
+    return [MASViewAttribute attributeWithView:self.view item:self.topLayoutGuide layoutAttribute:NSLayoutAttributeTop];
 }
 - (MASViewAttribute *)mas_topLayoutGuideBottom {
-    return [[MASViewAttribute alloc] initWithView:self.view item:self.topLayoutGuide layoutAttribute:NSLayoutAttributeBottom];
+    return [MASViewAttribute attributeWithView:self.view item:self.topLayoutGuide layoutAttribute:NSLayoutAttributeBottom];
 }
 
 - (MASViewAttribute *)mas_bottomLayoutGuide {
-    return [[MASViewAttribute alloc] initWithView:self.view item:self.bottomLayoutGuide layoutAttribute:NSLayoutAttributeTop];
+    return [MASViewAttribute attributeWithView:self.view item:self.bottomLayoutGuide layoutAttribute:NSLayoutAttributeTop];
 }
 - (MASViewAttribute *)mas_bottomLayoutGuideTop {
-    return [[MASViewAttribute alloc] initWithView:self.view item:self.bottomLayoutGuide layoutAttribute:NSLayoutAttributeTop];
+    return [MASViewAttribute attributeWithView:self.view item:self.bottomLayoutGuide layoutAttribute:NSLayoutAttributeTop];
 }
 - (MASViewAttribute *)mas_bottomLayoutGuideBottom {
-    return [[MASViewAttribute alloc] initWithView:self.view item:self.bottomLayoutGuide layoutAttribute:NSLayoutAttributeBottom];
+    return [MASViewAttribute attributeWithView:self.view item:self.bottomLayoutGuide layoutAttribute:NSLayoutAttributeBottom];
 }
 
 #pragma clang diagnostic pop
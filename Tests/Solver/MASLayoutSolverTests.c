@@ -0,0 +1,225 @@
+//
+//  MASLayoutSolverTests.c
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+//  Plain C tests of MASLayoutSolver and MASLayoutTree, which need neither Foundation nor XCTest.
+//  Built and run by script/test-solver.sh, eg on Linux CI.
+//
+
+#include "MASLayoutSolver.h"
+#include "MASLayoutTree.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int MASTestFailureCount;
+static int MASTestCheckCount;
+
+#define MAS_CHECK(condition) do { \
+    MASTestCheckCount++; \
+    if (!(condition)) { \
+        MASTestFailureCount++; \
+        fprintf(stderr, "%s:%d: %s: check failed: %s\n", __FILE__, __LINE__, __func__, #condition); \
+    } \
+} while (0)
+
+#define MAS_CHECK_VALUE(actual, expected) do { \
+    double mas_actual = (actual), mas_expected = (expected); \
+    MASTestCheckCount++; \
+    if (fabs(mas_actual - mas_expected) > 1e-6) { \
+        MASTestFailureCount++; \
+        fprintf(stderr, "%s:%d: %s: %s is %g, expected %g\n", __FILE__, __LINE__, __func__, #actual, mas_actual, mas_expected); \
+    } \
+} while (0)
+
+#define MAS_STRENGTH_REQUIRED MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED
+
+static void testRequiredConstraints(void) {
+    MASLayoutSolver *solver = MASLayoutSolverCreate();
+    MASLayoutVariable x = MASLayoutSolverAddVariable(solver);
+    MASLayoutVariable y = MASLayoutSolverAddVariable(solver);
+
+    // x == 10, y >= x + 5
+    MASLayoutSolverTerm fixX[] = { { x, 1 } };
+    MASLayoutSolverTerm yAfterX[] = { { y, 1 }, { x, -1 } };
+    MAS_CHECK(MASLayoutSolverAddConstraint(solver, fixX, 1, -10, MASLayoutSolverRelationEqual, MAS_STRENGTH_REQUIRED, NULL) == MASLayoutSolverStatusOK);
+    MAS_CHECK(MASLayoutSolverAddConstraint(solver, yAfterX, 2, -5, MASLayoutSolverRelationGreaterThanOrEqual, MAS_STRENGTH_REQUIRED, NULL) == MASLayoutSolverStatusOK);
+
+    MAS_CHECK_VALUE(MASLayoutSolverValue(solver, x), 10);
+    MAS_CHECK(MASLayoutSolverValue(solver, y) >= 15 - 1e-6);
+    MASLayoutSolverDestroy(solver);
+}
+
+static void testConflictingRequiredConstraintLeavesSolverUnchanged(void) {
+    MASLayoutSolver *solver = MASLayoutSolverCreate();
+    MASLayoutVariable x = MASLayoutSolverAddVariable(solver);
+    MASLayoutSolverTerm terms[] = { { x, 1 } };
+    MASLayoutSolverAddConstraint(solver, terms, 1, -10, MASLayoutSolverRelationEqual, MAS_STRENGTH_REQUIRED, NULL);
+
+    MASLayoutSolverConstraint constraint;
+    MAS_CHECK(MASLayoutSolverAddConstraint(solver, terms, 1, -20, MASLayoutSolverRelationEqual, MAS_STRENGTH_REQUIRED, &constraint) == MASLayoutSolverStatusUnsatisfiable);
+    MAS_CHECK(constraint == MASLayoutSolverConstraintInvalid);
+    MAS_CHECK_VALUE(MASLayoutSolverValue(solver, x), 10);
+    MAS_CHECK(MASLayoutSolverConstraintCount(solver) == 1);
+    MASLayoutSolverDestroy(solver);
+}
+
+static void testHigherPriorityWins(void) {
+    MASLayoutSolver *solver = MASLayoutSolverCreate();
+    MASLayoutVariable x = MASLayoutSolverAddVariable(solver);
+    MASLayoutSolverTerm terms[] = { { x, 1 } };
+    MASLayoutSolverAddConstraint(solver, terms, 1, -10, MASLayoutSolverRelationEqual, MASLayoutSolverStrengthForPriority(250), NULL);
+
+    MASLayoutSolverConstraint high;
+    MASLayoutSolverAddConstraint(solver, terms, 1, -100, MASLayoutSolverRelationEqual, MASLayoutSolverStrengthForPriority(750), &high);
+    MAS_CHECK_VALUE(MASLayoutSolverValue(solver, x), 100);
+
+    MAS_CHECK(MASLayoutSolverRemoveConstraint(solver, high) == MASLayoutSolverStatusOK);
+    MAS_CHECK_VALUE(MASLayoutSolverValue(solver, x), 10);
+    MAS_CHECK(MASLayoutSolverRemoveConstraint(solver, high) == MASLayoutSolverStatusInvalidHandle);
+    MASLayoutSolverDestroy(solver);
+}
+
+static void testSetConstantReoptimizes(void) {
+    MASLayoutSolver *solver = MASLayoutSolverCreate();
+    MASLayoutVariable x = MASLayoutSolverAddVariable(solver);
+    MASLayoutSolverTerm terms[] = { { x, 1 } };
+
+    // x == 10, x <= 20
+    MASLayoutSolverConstraint fixX;
+    MASLayoutSolverAddConstraint(solver, terms, 1, -10, MASLayoutSolverRelationEqual, MAS_STRENGTH_REQUIRED, &fixX);
+    MASLayoutSolverAddConstraint(solver, terms, 1, -20, MASLayoutSolverRelationLessThanOrEqual, MAS_STRENGTH_REQUIRED, NULL);
+
+    MAS_CHECK(MASLayoutSolverSetConstant(solver, fixX, -15) == MASLayoutSolverStatusOK);
+    MAS_CHECK_VALUE(MASLayoutSolverConstant(solver, fixX), -15);
+    MAS_CHECK_VALUE(MASLayoutSolverValue(solver, x), 15);
+
+    MAS_CHECK(MASLayoutSolverSetConstant(solver, fixX, -30) == MASLayoutSolverStatusUnsatisfiable);
+    MAS_CHECK_VALUE(MASLayoutSolverConstant(solver, fixX), -15);
+    MAS_CHECK_VALUE(MASLayoutSolverValue(solver, x), 15);
+    MASLayoutSolverDestroy(solver);
+}
+
+static void testSuggestedValuesRespectRequiredConstraints(void) {
+    MASLayoutSolver *solver = MASLayoutSolverCreate();
+    MASLayoutVariable x = MASLayoutSolverAddVariable(solver);
+    MASLayoutVariable y = MASLayoutSolverAddVariable(solver);
+
+    // y >= x + 10, y <= 100
+    MASLayoutSolverTerm yAfterX[] = { { y, 1 }, { x, -1 } };
+    MASLayoutSolverTerm yTerms[] = { { y, 1 } };
+    MASLayoutSolverAddConstraint(solver, yAfterX, 2, -10, MASLayoutSolverRelationGreaterThanOrEqual, MAS_STRENGTH_REQUIRED, NULL);
+    MASLayoutSolverAddConstraint(solver, yTerms, 1, -100, MASLayoutSolverRelationLessThanOrEqual, MAS_STRENGTH_REQUIRED, NULL);
+
+    MAS_CHECK(MASLayoutSolverAddEditVariable(solver, x, MAS_STRENGTH_REQUIRED) == MASLayoutSolverStatusOK);
+    MAS_CHECK(MASLayoutSolverSuggestValue(solver, x, 40) == MASLayoutSolverStatusOK);
+    MAS_CHECK_VALUE(MASLayoutSolverValue(solver, x), 40);
+    MAS_CHECK(MASLayoutSolverValue(solver, y) >= 50 - 1e-6);
+
+    MAS_CHECK(MASLayoutSolverSuggestValue(solver, x, 200) == MASLayoutSolverStatusOK);
+    MAS_CHECK_VALUE(MASLayoutSolverValue(solver, x), 90);
+
+    MAS_CHECK(MASLayoutSolverRemoveEditVariable(solver, x) == MASLayoutSolverStatusOK);
+    MAS_CHECK(MASLayoutSolverSuggestValue(solver, x, 10) == MASLayoutSolverStatusInvalidHandle);
+    MASLayoutSolverDestroy(solver);
+}
+
+static void testTreeFrames(void) {
+    MASLayoutTree *tree = MASLayoutTreeCreate();
+    MASLayoutItem item = MASLayoutTreeAddItem(tree, MASLayoutItemRoot);
+    MASLayoutItem child = MASLayoutTreeAddItem(tree, item);
+    MASLayoutTreeSetRootSize(tree, 320, MAS_LAYOUT_TREE_NO_METRIC);
+
+    // item.edges.equalTo(root).insets(10) with a fixed height, child.center.equalTo(item) with an intrinsic size
+    MASLayoutTreeConstraint constraints[] = {
+        { item, MASLayoutTreeAttributeLeft, MASLayoutSolverRelationEqual, MASLayoutItemRoot, MASLayoutTreeAttributeLeft, 1, 10, 1000 },
+        { item, MASLayoutTreeAttributeRight, MASLayoutSolverRelationEqual, MASLayoutItemRoot, MASLayoutTreeAttributeRight, 1, -10, 1000 },
+        { item, MASLayoutTreeAttributeTop, MASLayoutSolverRelationEqual, MASLayoutItemRoot, MASLayoutTreeAttributeTop, 1, 10, 1000 },
+        { item, MASLayoutTreeAttributeHeight, MASLayoutSolverRelationEqual, MASLayoutItemNone, MASLayoutTreeAttributeNone, 1, 100, 1000 },
+        { MASLayoutItemRoot, MASLayoutTreeAttributeBottom, MASLayoutSolverRelationEqual, item, MASLayoutTreeAttributeBottom, 1, 10, 1000 },
+        { child, MASLayoutTreeAttributeCenterX, MASLayoutSolverRelationEqual, item, MASLayoutTreeAttributeCenterX, 1, 0, 1000 },
+        { child, MASLayoutTreeAttributeCenterY, MASLayoutSolverRelationEqual, item, MASLayoutTreeAttributeCenterY, 1, 0, 1000 },
+    };
+    for (size_t i = 0; i < sizeof(constraints) / sizeof(constraints[0]); i++) {
+        MAS_CHECK(MASLayoutTreeAddConstraint(tree, &constraints[i], NULL) == MASLayoutSolverStatusOK);
+    }
+    MASLayoutTreeSetIntrinsicSize(tree, child, 40, 20);
+
+    MASLayoutRect rootFrame = MASLayoutTreeFrame(tree, MASLayoutItemRoot);
+    MASLayoutRect itemFrame = MASLayoutTreeFrame(tree, item);
+    MASLayoutRect childFrame = MASLayoutTreeFrame(tree, child);
+    MAS_CHECK_VALUE(rootFrame.height, 120);
+    MAS_CHECK_VALUE(itemFrame.x, 10);
+    MAS_CHECK_VALUE(itemFrame.width, 300);
+    MAS_CHECK_VALUE(childFrame.x, 130);
+    MAS_CHECK_VALUE(childFrame.y, 40);
+    MAS_CHECK_VALUE(childFrame.width, 40);
+
+    MASLayoutTreeDestroy(tree);
+}
+
+static void testTreeRejectsUnsupportedAttributes(void) {
+    MASLayoutTree *tree = MASLayoutTreeCreate();
+    MASLayoutItem item = MASLayoutTreeAddItem(tree, MASLayoutItemRoot);
+
+    // NSLayoutAttributeLastBaseline
+    MASLayoutTreeConstraint baseline = { item, 11, MASLayoutSolverRelationEqual, MASLayoutItemRoot, 11, 1, 0, 1000 };
+    MAS_CHECK(MASLayoutTreeAddConstraint(tree, &baseline, NULL) == MASLayoutSolverStatusUnsupported);
+
+    MASLayoutTreeDestroy(tree);
+}
+
+static void testAnimatingConstants(void) {
+    // a row of 200 items, all spacings change every frame like an animated offset
+    MASLayoutTree *tree = MASLayoutTreeCreate();
+    MASLayoutTreeSetRootSize(tree, 10000, 100);
+
+    const int count = 200;
+    MASLayoutSolverConstraint *spacings = calloc(count, sizeof(MASLayoutSolverConstraint));
+    MASLayoutItem previous = MASLayoutItemRoot;
+    for (int i = 0; i < count; i++) {
+        MASLayoutItem item = MASLayoutTreeAddItem(tree, MASLayoutItemRoot);
+        MASLayoutTreeConstraint constraints[] = {
+            { item, MASLayoutTreeAttributeLeft, MASLayoutSolverRelationEqual, previous, previous == MASLayoutItemRoot ? MASLayoutTreeAttributeLeft : MASLayoutTreeAttributeRight, 1, 2, 1000 },
+            { item, MASLayoutTreeAttributeWidth, MASLayoutSolverRelationEqual, MASLayoutItemNone, MASLayoutTreeAttributeNone, 1, 20, 1000 },
+            { item, MASLayoutTreeAttributeTop, MASLayoutSolverRelationEqual, MASLayoutItemRoot, MASLayoutTreeAttributeTop, 1, 0, 1000 },
+            { item, MASLayoutTreeAttributeHeight, MASLayoutSolverRelationEqual, MASLayoutItemRoot, MASLayoutTreeAttributeHeight, 1, 0, 1000 },
+        };
+        MASLayoutTreeAddConstraint(tree, &constraints[0], &spacings[i]);
+        for (size_t j = 1; j < sizeof(constraints) / sizeof(constraints[0]); j++) {
+            MASLayoutTreeAddConstraint(tree, &constraints[j], NULL);
+        }
+        previous = item;
+    }
+
+    int frame = 0;
+    for (; frame < 60; frame++) {
+        for (int j = 0; j < count; j++) {
+            MAS_CHECK(MASLayoutTreeSetConstant(tree, spacings[j], 2 + (frame % 10)) == MASLayoutSolverStatusOK);
+        }
+    }
+
+    MASLayoutRect last = MASLayoutTreeFrame(tree, previous);
+    MAS_CHECK_VALUE(last.x, count * (2 + (frame - 1) % 10) + (count - 1) * 20);
+
+    free(spacings);
+    MASLayoutTreeDestroy(tree);
+}
+
+int main(void) {
+    testRequiredConstraints();
+    testConflictingRequiredConstraintLeavesSolverUnchanged();
+    testHigherPriorityWins();
+    testSetConstantReoptimizes();
+    testSuggestedValuesRespectRequiredConstraints();
+    testTreeFrames();
+    testTreeRejectsUnsupportedAttributes();
+    testAnimatingConstants();
+
+    printf("%d checks, %d failures\n", MASTestCheckCount, MASTestFailureCount);
+    return MASTestFailureCount ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,331 @@
+//
+//  MASBenchmarkSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "View+MASAdditions.h"
+#import "NSArray+MASAdditions.h"
+#import "MASConstraintPool.h"
+#import "MASConstraintAnimator.h"
+#import <mach/mach_time.h>
+
+// libmalloc reports every allocation to this hook, it is what malloc stack logging is built on
+typedef void (MASMallocLogger)(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t framesToSkip);
+extern MASMallocLogger *malloc_logger;
+
+enum {
+    MASMallocLogTypeAllocate = 2,
+    MASMallocLogTypeDeallocate = 4,
+};
+
+static uint64_t MASBenchmarkAllocationCount;
+static uint64_t MASBenchmarkAllocationBytes;
+
+// the clock of the animator benchmark, advanced one frame at a time
+static CFTimeInterval MASBenchmarkAnimatorTime;
+
+static void MASBenchmarkMallocLogger(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t framesToSkip) {
+    if (!(type & MASMallocLogTypeAllocate)) return;
+    // realloc passes the old pointer before the new size
+    uintptr_t size = (type & MASMallocLogTypeDeallocate) ? arg3 : arg2;
+    __atomic_fetch_add(&MASBenchmarkAllocationCount, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&MASBenchmarkAllocationBytes, size, __ATOMIC_RELAXED);
+}
+
+static double MASBenchmarkNanoseconds(void) {
+    static mach_timebase_info_data_t timebase;
+    if (!timebase.denom) mach_timebase_info(&timebase);
+    return (double)mach_absolute_time() * timebase.numer / timebase.denom;
+}
+
+static const NSUInteger MASBenchmarkCounts[] = { 10, 100, 1000, 10000 };
+static const NSUInteger MASBenchmarkCountsLength = sizeof(MASBenchmarkCounts) / sizeof(MASBenchmarkCounts[0]);
+
+// time per view may grow by this power of the view count, linear scenarios fit slightly above 1
+static const double MASBenchmarkMaximumSlope = 1.5;
+
+typedef struct {
+    double nanoseconds;
+    double allocations;
+    double bytes;
+} MASBenchmarkSample;
+
+/**
+ *  Benchmarks of the Masonry entry points against hand written NSLayoutConstraint code.
+ *
+ *  Skipped unless the MAS_BENCHMARK environment variable is set, see script/benchmark.sh.
+ *  Every scenario runs for 10 to 10,000 views and reports ns, allocations and bytes per view,
+ *  then fits time against view count on a log-log scale and fails if it grows clearly faster than linear.
+ *  With MAS_BENCHMARK_OUTPUT set, results are also appended to that file as JSON lines for tracking over time.
+ */
+SpecBegin(MASBenchmark) {
+    NSMutableArray *results;
+    // subviews don't retain their superview
+    NSMutableArray *superviews;
+}
+
+- (void)setUp {
+    results = [NSMutableArray array];
+    superviews = [NSMutableArray array];
+}
+
+- (void)tearDown {
+    NSString *outputPath = NSProcessInfo.processInfo.environment[@"MAS_BENCHMARK_OUTPUT"];
+    if (!outputPath.length || !results.count) return;
+
+    NSMutableData *data = [NSMutableData data];
+    for (NSDictionary *result in results) {
+        [data appendData:[NSJSONSerialization dataWithJSONObject:result options:0 error:NULL]];
+        [data appendBytes:"\n" length:1];
+    }
+    NSFileHandle *file = [NSFileHandle fileHandleForWritingAtPath:outputPath];
+    if (!file) {
+        [data writeToFile:outputPath atomically:YES];
+        return;
+    }
+    [file seekToEndOfFile];
+    [file writeData:data];
+    [file closeFile];
+}
+
+#pragma mark - harness
+
+- (BOOL)isEnabled {
+    return NSProcessInfo.processInfo.environment[@"MAS_BENCHMARK"] != nil;
+}
+
+- (NSArray *)subviewsOfNewSuperviewWithCount:(NSUInteger)count {
+    MAS_VIEW *superview = [[MAS_VIEW alloc] initWithFrame:CGRectMake(0, 0, 320, 480)];
+    [superviews addObject:superview];
+    NSMutableArray *views = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        MAS_VIEW *view = MAS_VIEW.new;
+        [superview addSubview:view];
+        [views addObject:view];
+    }
+    return views;
+}
+
+- (MASBenchmarkSample)sampleWithCount:(NSUInteger)count setUp:(id(^)(NSUInteger count))setUp operation:(void(^)(id context))operation {
+    MASBenchmarkSample best = { INFINITY, INFINITY, INFINITY };
+    double elapsed = 0;
+    // small counts are repeated until the timer resolution no longer matters
+    for (NSUInteger run = 0; run < 3 || (elapsed < 50e6 && run < 1000); run++) {
+        @autoreleasepool {
+            id context = setUp(count);
+
+            uint64_t allocations = __atomic_load_n(&MASBenchmarkAllocationCount, __ATOMIC_RELAXED);
+            uint64_t bytes = __atomic_load_n(&MASBenchmarkAllocationBytes, __ATOMIC_RELAXED);
+            double start = MASBenchmarkNanoseconds();
+            @autoreleasepool {
+                operation(context);
+            }
+            double nanoseconds = MASBenchmarkNanoseconds() - start;
+            elapsed += nanoseconds;
+
+            best.nanoseconds = MIN(best.nanoseconds, nanoseconds / count);
+            best.allocations = MIN(best.allocations, (double)(__atomic_load_n(&MASBenchmarkAllocationCount, __ATOMIC_RELAXED) - allocations) / count);
+            best.bytes = MIN(best.bytes, (double)(__atomic_load_n(&MASBenchmarkAllocationBytes, __ATOMIC_RELAXED) - bytes) / count);
+            [superviews removeAllObjects];
+        }
+    }
+    return best;
+}
+
+- (void)benchmark:(NSString *)name setUp:(id(^)(NSUInteger count))setUp operation:(void(^)(id context))operation {
+    if (!self.isEnabled) return;
+
+    MASMallocLogger *previousLogger = malloc_logger;
+    malloc_logger = MASBenchmarkMallocLogger;
+
+    // least squares fit of log(total time) = a + slope * log(count)
+    double sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+    for (NSUInteger i = 0; i < MASBenchmarkCountsLength; i++) {
+        NSUInteger count = MASBenchmarkCounts[i];
+        MASBenchmarkSample sample = [self sampleWithCount:count setUp:setUp operation:operation];
+        printf("%-24s %6lu views %10.0f ns/op %8.1f allocs/op %10.0f bytes/op\n",
+               name.UTF8String, (unsigned long)count, sample.nanoseconds, sample.allocations, sample.bytes);
+        [results addObject:@{
+            @"benchmark": name,
+            @"count": @(count),
+            @"nsPerOp": @(sample.nanoseconds),
+            @"allocationsPerOp": @(sample.allocations),
+            @"bytesPerOp": @(sample.bytes),
+        }];
+
+        double x = log((double)count);
+        double y = log(sample.nanoseconds * count);
+        sumX += x;
+        sumY += y;
+        sumXX += x * x;
+        sumXY += x * y;
+    }
+
+    malloc_logger = previousLogger;
+
+    double n = MASBenchmarkCountsLength;
+    double slope = (n * sumXY - sumX * sumY) / (n * sumXX - sumX * sumX);
+    printf("%-24s scaling O(n^%.2f)\n", name.UTF8String, slope);
+    [results addObject:@{ @"benchmark": name, @"slope": @(slope) }];
+    XCTAssertLessThan(slope, MASBenchmarkMaximumSlope, @"%@ scales superlinearly", name);
+}
+
+#pragma mark - scenarios
+
+- (void)testMakeConstraints {
+    [self benchmark:@"mas_makeConstraints" setUp:^id(NSUInteger count) {
+        return [self subviewsOfNewSuperviewWithCount:count];
+    } operation:^(NSArray *views) {
+        for (MAS_VIEW *view in views) {
+            [view mas_makeConstraints:^(MASConstraintMaker *make) {
+                make.left.top.equalTo(view.superview).offset(10);
+                make.size.equalTo(@20);
+            }];
+        }
+    }];
+}
+
+- (void)testLayoutConstraints {
+    [self benchmark:@"NSLayoutConstraint" setUp:^id(NSUInteger count) {
+        return [self subviewsOfNewSuperviewWithCount:count];
+    } operation:^(NSArray *views) {
+        for (MAS_VIEW *view in views) {
+            MAS_VIEW *superview = view.superview;
+            view.translatesAutoresizingMaskIntoConstraints = NO;
+            [superview addConstraint:[NSLayoutConstraint constraintWithItem:view attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationEqual
+                                                                     toItem:superview attribute:NSLayoutAttributeLeft multiplier:1 constant:10]];
+            [superview addConstraint:[NSLayoutConstraint constraintWithItem:view attribute:NSLayoutAttributeTop relatedBy:NSLayoutRelationEqual
+                                                                     toItem:superview attribute:NSLayoutAttributeTop multiplier:1 constant:10]];
+            [view addConstraint:[NSLayoutConstraint constraintWithItem:view attribute:NSLayoutAttributeWidth relatedBy:NSLayoutRelationEqual
+                                                                toItem:nil attribute:NSLayoutAttributeNotAnAttribute multiplier:1 constant:20]];
+            [view addConstraint:[NSLayoutConstraint constraintWithItem:view attribute:NSLayoutAttributeHeight relatedBy:NSLayoutRelationEqual
+                                                                toItem:nil attribute:NSLayoutAttributeNotAnAttribute multiplier:1 constant:20]];
+        }
+    }];
+}
+
+- (void)testUpdateConstraints {
+    [self benchmark:@"mas_updateConstraints" setUp:^id(NSUInteger count) {
+        NSArray *views = [self subviewsOfNewSuperviewWithCount:count];
+        [views mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.left.top.equalTo([views.firstObject superview]).offset(10);
+            make.size.equalTo(@20);
+        }];
+        return views;
+    } operation:^(NSArray *views) {
+        for (MAS_VIEW *view in views) {
+            [view mas_updateConstraints:^(MASConstraintMaker *make) {
+                make.left.equalTo(view.superview).offset(20);
+            }];
+        }
+    }];
+}
+
+- (void)testRemakeConstraints {
+    [self benchmark:@"mas_remakeConstraints" setUp:^id(NSUInteger count) {
+        NSArray *views = [self subviewsOfNewSuperviewWithCount:count];
+        [views mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.left.top.equalTo([views.firstObject superview]).offset(10);
+            make.size.equalTo(@20);
+        }];
+        return views;
+    } operation:^(NSArray *views) {
+        for (MAS_VIEW *view in views) {
+            [view mas_remakeConstraints:^(MASConstraintMaker *make) {
+                make.left.equalTo(view.superview).offset(20);
+                make.top.equalTo(view.superview).offset(10);
+                make.size.equalTo(@20);
+            }];
+        }
+    }];
+}
+
+- (void)benchmarkRemakeBetweenLayouts:(NSString *)name {
+    [self benchmark:name setUp:^id(NSUInteger count) {
+        NSArray *views = [self subviewsOfNewSuperviewWithCount:count];
+        [views mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.left.top.equalTo([views.firstObject superview]).offset(10);
+            make.size.equalTo(@20);
+        }];
+        return views;
+    } operation:^(NSArray *views) {
+        // a view toggling between two states, eg expanded and collapsed
+        for (MAS_VIEW *view in views) {
+            [view mas_remakeConstraints:^(MASConstraintMaker *make) {
+                make.right.bottom.equalTo(view.superview).offset(-10);
+                make.size.equalTo(@20);
+            }];
+            [view mas_remakeConstraints:^(MASConstraintMaker *make) {
+                make.left.top.equalTo(view.superview).offset(10);
+                make.size.equalTo(@20);
+            }];
+        }
+    }];
+}
+
+- (void)testRemakeBetweenLayouts {
+    [self benchmarkRemakeBetweenLayouts:@"remake between layouts"];
+}
+
+- (void)testRemakeBetweenLayoutsWithConstraintPool {
+    MASConstraintPool.enabled = YES;
+    [self benchmarkRemakeBetweenLayouts:@"remake between layouts pooled"];
+    MASConstraintPool.enabled = NO;
+}
+
+- (void)testAnimateConstants {
+    [self benchmark:@"MASConstraintAnimator" setUp:^id(NSUInteger count) {
+        MASBenchmarkAnimatorTime = 0;
+        MASConstraintAnimator *animator = [[MASConstraintAnimator alloc] initWithClock:^CFTimeInterval{
+            return MASBenchmarkAnimatorTime;
+        }];
+        for (MAS_VIEW *view in [self subviewsOfNewSuperviewWithCount:count]) {
+            __block MASConstraint *left;
+            [view mas_makeConstraints:^(MASConstraintMaker *make) {
+                left = make.left.equalTo(view.superview);
+                make.top.equalTo(view.superview);
+                make.size.equalTo(@20);
+            }];
+            [animator animateConstraint:left toConstant:100 duration:1 curve:MASAnimationCurveEaseInOut];
+        }
+        return animator;
+    } operation:^(MASConstraintAnimator *animator) {
+        // one second at 60 frames per second
+        for (NSUInteger frame = 1; frame <= 60; frame++) {
+            MASBenchmarkAnimatorTime = frame / 60.0;
+            [animator tick];
+        }
+    }];
+}
+
+- (void)testDistributeViews {
+    [self benchmark:@"mas_distributeViews" setUp:^id(NSUInteger count) {
+        return [self subviewsOfNewSuperviewWithCount:MAX(count, 2)];
+    } operation:^(NSArray *views) {
+        [views mas_distributeViewsAlongAxis:MASAxisTypeHorizontal withFixedSpacing:1 leadSpacing:0 tailSpacing:0];
+    }];
+}
+
+- (void)testClosestCommonSuperview {
+    [self benchmark:@"mas_closestCommonSuperview" setUp:^id(NSUInteger count) {
+        // every view is wrapped in its own container, so each lookup walks up to the shared superview
+        NSArray *level = [self subviewsOfNewSuperviewWithCount:count];
+        NSMutableArray *leaves = [NSMutableArray arrayWithCapacity:count];
+        for (MAS_VIEW *view in level) {
+            MAS_VIEW *leaf = MAS_VIEW.new;
+            [view addSubview:leaf];
+            [leaves addObject:leaf];
+        }
+        return leaves;
+    } operation:^(NSArray *views) {
+        NSUInteger count = views.count;
+        for (NSUInteger i = 0; i < count; i++) {
+            [views[i] mas_closestCommonSuperview:views[(i + 1) % count]];
+        }
+    }];
+}
+
+SpecEnd
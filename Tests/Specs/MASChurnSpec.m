@@ -0,0 +1,127 @@
+//
+//  MASChurnSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASChurn.h"
+#import "MASChurn+Private.h"
+#import "View+MASAdditions.h"
+
+SpecBegin(MASChurn) {
+    MAS_VIEW *superview;
+    MAS_VIEW *view;
+}
+
+- (void)setUp {
+    superview = MAS_VIEW.new;
+    view = MAS_VIEW.new;
+    [superview addSubview:view];
+}
+
+- (void)tearDown {
+    MASChurn.thrashHandler = nil;
+    MASChurn.thrashThreshold = 10;
+    MASChurn.maximumKeyCount = 1024;
+}
+
+- (void)testCountsEvents {
+    view.mas_key = @"churnView";
+    MASChurnCounts globalCounts = MASChurn.globalCounts;
+
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.left.top.equalTo(superview);
+        make.width.equalTo(@10);
+    }];
+    [view mas_updateConstraints:^(MASConstraintMaker *make) {
+        make.width.equalTo(@20);
+    }];
+    // the width constraint is adopted, the top constraint removed
+    [view mas_remakeConstraints:^(MASConstraintMaker *make) {
+        make.left.equalTo(superview);
+        make.width.equalTo(@30);
+    }];
+    // the top constraint comes back
+    [view mas_remakeConstraints:^(MASConstraintMaker *make) {
+        make.left.top.equalTo(superview);
+        make.width.equalTo(@30);
+    }];
+
+    MASChurnCounts counts = [MASChurn countsForView:view];
+    expect(counts.counts[MASChurnEventCreated]).to.equal(3);
+    expect(counts.counts[MASChurnEventUpdatedInPlace]).to.equal(5);
+    expect(counts.counts[MASChurnEventUninstalled]).to.equal(1);
+    expect(counts.counts[MASChurnEventReinstalled]).to.equal(1);
+    expect(counts.counts[MASChurnEventReactivated]).to.equal(0);
+
+    MASChurnCounts keyCounts = [MASChurn countsForKey:@"churnView"];
+    expect(keyCounts.counts[MASChurnEventCreated]).to.equal(3);
+    expect(MASChurn.globalCounts.counts[MASChurnEventCreated] - globalCounts.counts[MASChurnEventCreated]).to.beGreaterThanOrEqualTo(3);
+}
+
+- (void)testLimitsCountsPerKey {
+    MASChurn.maximumKeyCount = 2;
+    for (NSString *key in @[@"first", @"second", @"third"]) {
+        MAS_VIEW *keyedView = MAS_VIEW.new;
+        keyedView.mas_key = key;
+        [superview addSubview:keyedView];
+        [keyedView mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.width.equalTo(@10);
+        }];
+    }
+
+    expect([MASChurn countsForKey:@"first"].counts[MASChurnEventCreated]).to.equal(0);
+    expect([MASChurn countsForKey:@"third"].counts[MASChurnEventCreated]).to.equal(1);
+}
+
+- (void)testIgnoresNilViews {
+    MASChurnRecordUninstall(nil, 1);
+    MASChurnRecordInstall(nil, 1);
+    MASChurnRecordRepeatedPass(nil);
+    expect(MASChurnCountForView(nil, MASChurnEventCreated)).to.equal(0);
+}
+
+- (void)testReactivation {
+    __block MASConstraint *width;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        width = make.width.equalTo(@10);
+    }];
+    [width deactivate];
+    [width activate];
+
+    MASChurnCounts counts = [MASChurn countsForView:view];
+    expect(counts.counts[MASChurnEventUninstalled]).to.equal(1);
+    expect(counts.counts[MASChurnEventReactivated]).to.equal(1);
+}
+
+- (void)testDetectsThrashing {
+    MASChurn.thrashThreshold = 3;
+    __block NSUInteger reports = 0;
+    __block MAS_VIEW *reportedView;
+    MASChurn.thrashHandler = ^(MAS_VIEW *thrashingView, id key) {
+        reports++;
+        reportedView = thrashingView;
+    };
+
+    for (int i = 0; i < 6; i++) {
+        [view mas_remakeConstraints:^(MASConstraintMaker *make) {
+            make.edges.equalTo(superview);
+        }];
+    }
+    expect(reports).to.equal(1);
+    expect(reportedView).to.beIdenticalTo(view);
+
+    // updating constants is not thrashing
+    MAS_VIEW *otherView = MAS_VIEW.new;
+    [superview addSubview:otherView];
+    for (int i = 0; i < 6; i++) {
+        [otherView mas_updateConstraints:^(MASConstraintMaker *make) {
+            make.width.equalTo(@(i));
+        }];
+    }
+    expect(reports).to.equal(1);
+}
+
+SpecEnd
@@ -111,6 +111,47 @@ SpecBegin(MASCompositeConstraint) {
     expect(composite.childConstraints[1]).to.beKindOf(MASCompositeConstraint.class);
 }
 
+- (void)testAdoptChildrenOfCompositeChildren {
+    MASCompositeConstraint *size = [[MASCompositeConstraint alloc] initWithChildren:@[
+        [[MASViewConstraint alloc] initWithFirstViewAttribute:view.mas_width],
+        [[MASViewConstraint alloc] initWithFirstViewAttribute:view.mas_height]
+    ]];
+    MASViewConstraint *left = [[MASViewConstraint alloc] initWithFirstViewAttribute:view.mas_left];
+    composite = [[MASCompositeConstraint alloc] initWithChildren:@[size, left]];
+    composite.delegate = delegate;
+
+    expect(composite.childConstraints).to.haveCountOf(3);
+    expect(composite.childConstraints[0]).to.beIdenticalTo(size.childConstraints[0]);
+    expect(composite.childConstraints[2]).to.beIdenticalTo(left);
+    expect([composite.childConstraints[1] delegate]).to.beIdenticalTo(composite);
+
+    composite.multipliedBy(2).priorityLow();
+    for (MASViewConstraint *viewConstraint in composite.childConstraints) {
+        expect(viewConstraint.layoutMultiplier).to.equal(2);
+        expect(viewConstraint.layoutPriority).to.equal(MASLayoutPriorityDefaultLow);
+    }
+}
+
+- (void)testReplaceChildAtItsIndex {
+    NSArray *children = @[
+        [[MASViewConstraint alloc] initWithFirstViewAttribute:view.mas_left],
+        [[MASViewConstraint alloc] initWithFirstViewAttribute:view.mas_right],
+        [[MASViewConstraint alloc] initWithFirstViewAttribute:view.mas_top]
+    ];
+    composite = [[MASCompositeConstraint alloc] initWithChildren:children];
+    composite.delegate = delegate;
+    MAS_VIEW *otherView = MAS_VIEW.new;
+    [superview addSubview:otherView];
+
+    MASViewConstraint *right = children[1];
+    MASConstraint *replacement = right.equalTo(@[otherView, @10]);
+
+    expect(composite.childConstraints).to.haveCountOf(3);
+    expect(composite.childConstraints[0]).to.beIdenticalTo(children[0]);
+    expect(composite.childConstraints[1]).to.beIdenticalTo(replacement);
+    expect(composite.childConstraints[2]).to.beIdenticalTo(children[2]);
+}
+
 - (void)testModifyInsetsOnAppropriateChildren {
     NSArray *children = @[
         [[MASViewConstraint alloc] initWithFirstViewAttribute:view.mas_right],
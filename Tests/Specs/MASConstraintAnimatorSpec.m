@@ -0,0 +1,109 @@
+//
+//  MASConstraintAnimatorSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASConstraintAnimator.h"
+#import "MASViewConstraint.h"
+#import "MASViewConstraint+Private.h"
+#import "View+MASAdditions.h"
+
+SpecBegin(MASConstraintAnimator) {
+    MAS_VIEW *superview;
+    MAS_VIEW *view;
+    MASConstraintAnimator *animator;
+    CFTimeInterval now;
+}
+
+- (void)setUp {
+    superview = [[MAS_VIEW alloc] initWithFrame:CGRectMake(0, 0, 200, 200)];
+    view = MAS_VIEW.new;
+    [superview addSubview:view];
+    now = 0;
+    animator = [[MASConstraintAnimator alloc] initWithClock:^CFTimeInterval{
+        return now;
+    }];
+}
+
+- (void)testInterpolatesAndLaysOut {
+    __block MASViewConstraint *left;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        left = (id)make.left.equalTo(superview);
+        make.top.equalTo(superview);
+        make.size.equalTo(@50);
+    }];
+    [superview layoutIfNeeded];
+
+    [animator animateConstraint:left toConstant:100 duration:1 curve:MASAnimationCurveLinear];
+    expect(animator.animationCount).to.equal(1);
+
+    now = 0.25;
+    expect([animator tick]).to.equal(1);
+    expect(left.layoutConstraint.constant).to.equal(25);
+    expect(view.frame.origin.x).to.equal(25);
+
+    // nothing changed since the last tick, nothing is written
+    expect([animator tick]).to.equal(0);
+
+    now = 2;
+    expect([animator tick]).to.equal(1);
+    expect(left.layoutConstraint.constant).to.equal(100);
+    expect(view.frame.origin.x).to.equal(100);
+    expect(animator.animationCount).to.equal(0);
+}
+
+- (void)testAnimatesChildrenOfComposite {
+    __block MASConstraint *size;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        size = make.size.equalTo(@10);
+    }];
+    __block NSUInteger completionCount = 0;
+    animator.completion = ^{
+        completionCount++;
+    };
+
+    [animator animateConstraint:size toConstant:30 duration:1 curve:MASAnimationCurveEaseIn];
+    expect(animator.animationCount).to.equal(2);
+
+    now = 0.5;
+    expect([animator tick]).to.equal(2);
+    for (MASViewConstraint *constraint in [MASViewConstraint installedConstraintsForView:view]) {
+        // ease in is a quarter of the way at half time
+        expect(constraint.layoutConstraint.constant).to.equal(15);
+    }
+    expect(completionCount).to.equal(0);
+
+    now = 1;
+    [animator tick];
+    expect(completionCount).to.equal(1);
+    expect(animator.animationCount).to.equal(0);
+}
+
+- (void)testRetargetsFromCurrentConstant {
+    __block MASViewConstraint *width;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        width = (id)make.width.equalTo(@0);
+    }];
+
+    [animator animateConstraint:width toConstant:100 duration:1 curve:MASAnimationCurveLinear];
+    now = 0.5;
+    [animator tick];
+    expect(width.layoutConstraint.constant).to.equal(50);
+
+    [animator animateConstraint:width toConstant:0 duration:1 curve:MASAnimationCurveLinear];
+    expect(animator.animationCount).to.equal(1);
+    now = 1;
+    [animator tick];
+    expect(width.layoutConstraint.constant).to.equal(25);
+
+    [animator stopAnimatingConstraint:width];
+    expect(animator.animationCount).to.equal(0);
+    now = 2;
+    expect([animator tick]).to.equal(0);
+    expect(width.layoutConstraint.constant).to.equal(25);
+}
+
+SpecEnd
@@ -0,0 +1,105 @@
+//
+//  MASConstraintBatchSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASConstraintBatch.h"
+#import "View+MASAdditions.h"
+#import "NSArray+MASAdditions.h"
+
+SpecBegin(MASConstraintBatch) {
+    MAS_VIEW *superview;
+    MAS_VIEW *view1;
+    MAS_VIEW *view2;
+}
+
+- (void)setUp {
+    superview = MAS_VIEW.new;
+    view1 = MAS_VIEW.new;
+    view2 = MAS_VIEW.new;
+    [superview addSubview:view1];
+    [superview addSubview:view2];
+}
+
+- (void)testCommitsOnceBlockFinishes {
+    __block NSUInteger countDuringBatch = NSNotFound;
+    MASConstraintBatch *batch = [MASConstraintBatch performBatch:^{
+        [view1 mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.edges.equalTo(superview);
+        }];
+        [view2 mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.size.equalTo(view1);
+        }];
+        countDuringBatch = superview.constraints.count;
+    }];
+
+    expect(countDuringBatch).to.equal(0);
+    expect(superview.constraints).to.haveCountOf(6);
+    expect(batch.isCommitted).to.beTruthy();
+    expect(batch.activatedCount).to.equal(6);
+    expect(batch.engineCallCount).to.equal(1);
+    expect(batch.savedEngineCallCount).to.equal(5);
+}
+
+- (void)testMakerJoinsOpenBatch {
+    __block MASConstraintMaker *maker;
+    MASConstraintBatch *batch = [MASConstraintBatch performBatch:^{
+        [view1 mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.left.equalTo(superview);
+            maker = make;
+        }];
+    }];
+
+    expect(maker.batch).to.beIdenticalTo(batch);
+}
+
+- (void)testArrayAdditionsShareOneBatch {
+    __block MASConstraintMaker *firstMaker;
+    __block MASConstraintMaker *lastMaker;
+    [@[view1, view2] mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.top.equalTo(superview);
+        firstMaker = firstMaker ?: make;
+        lastMaker = make;
+    }];
+
+    expect(firstMaker.batch).to.beIdenticalTo(lastMaker.batch);
+    expect(firstMaker.batch.activatedCount).to.equal(2);
+    expect(superview.constraints).to.haveCountOf(2);
+}
+
+- (void)testRemakeDeactivatesInBulk {
+    [view1 mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.left.top.equalTo(superview);
+    }];
+
+    __block MASConstraintMaker *maker;
+    [view1 mas_remakeConstraints:^(MASConstraintMaker *make) {
+        make.right.bottom.equalTo(superview);
+        maker = make;
+    }];
+
+    expect(superview.constraints).to.haveCountOf(2);
+    expect(maker.batch.deactivatedCount).to.equal(2);
+    expect(maker.batch.activatedCount).to.equal(2);
+    expect(maker.batch.engineCallCount).to.equal(2);
+}
+
+- (void)testPendingActivationCancelledByDeactivation {
+    NSArray *constraints = [view1 mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.left.equalTo(superview);
+    }];
+    MASConstraint *constraint = constraints.firstObject;
+
+    MASConstraintBatch *batch = [MASConstraintBatch performBatch:^{
+        [constraint uninstall];
+        [constraint install];
+    }];
+
+    expect(superview.constraints).to.haveCountOf(1);
+    expect(batch.engineCallCount).to.equal(0);
+}
+
+SpecEnd
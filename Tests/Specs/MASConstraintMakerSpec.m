@@ -153,6 +153,43 @@ SpecBegin(MASConstraintMaker) {
     expect(constraint2).to.beIdenticalTo(constraint2);
 }
 
+- (void)testUpdateConstraintsMatchesMostRecentIndexedConstraint {
+    MAS_VIEW *newView = MAS_VIEW.new;
+    [superview addSubview:newView];
+
+    maker.left.equalTo(newView).offset(10);
+    maker.right.equalTo(newView).offset(20);
+    maker.width.equalTo(newView).offset(30);
+    [maker install];
+
+    maker.updateExisting = YES;
+    maker.right.equalTo(newView).offset(40);
+    [maker install];
+
+    expect(superview.constraints).to.haveCountOf(3);
+    NSLayoutConstraint *constraint = superview.constraints[1];
+    expect(constraint.firstAttribute).to.equal(NSLayoutAttributeRight);
+    expect(constraint.constant).to.equal(40);
+}
+
+- (void)testUpdateConstraintsIgnoresUninstalledConstraints {
+    MAS_VIEW *newView = MAS_VIEW.new;
+    [superview addSubview:newView];
+
+    maker.updateExisting = YES;
+    maker.left.equalTo(newView).offset(10);
+    NSArray *constraints = [maker install];
+    [constraints.firstObject uninstall];
+    expect(superview.constraints).to.haveCountOf(0);
+
+    maker.left.equalTo(newView).offset(20);
+    [maker install];
+
+    expect(superview.constraints).to.haveCountOf(1);
+    NSLayoutConstraint *constraint = superview.constraints[0];
+    expect(constraint.constant).to.equal(20);
+}
+
 - (void)testDoNotUpdateConstraints {
     MAS_VIEW *newView = MAS_VIEW.new;
     [superview addSubview:newView];
@@ -195,6 +232,94 @@ SpecBegin(MASConstraintMaker) {
     expect(constraint1.constant).to.equal(100);
 }
 
+- (void)testRemakeKeepsMatchingConstraints {
+    MAS_VIEW *newView = MAS_VIEW.new;
+    [superview addSubview:newView];
+
+    maker.left.equalTo(newView).offset(10);
+    maker.right.equalTo(newView).offset(20);
+    NSArray *oldConstraints = [maker install];
+    NSLayoutConstraint *leftConstraint = superview.constraints[0];
+    NSLayoutConstraint *rightConstraint = superview.constraints[1];
+
+    maker.removeExisting = YES;
+    maker.left.equalTo(newView).offset(10);
+    maker.right.equalTo(newView).offset(40);
+    maker.width.equalTo(newView).offset(30);
+    NSArray *newConstraints = [maker install];
+
+    expect(superview.constraints).to.haveCountOf(3);
+    expect(superview.constraints[0]).to.beIdenticalTo(leftConstraint);
+    expect(superview.constraints[1]).to.beIdenticalTo(rightConstraint);
+    expect(rightConstraint.constant).to.equal(40);
+    expect(maker.batch.deactivatedCount).to.equal(0);
+    expect(maker.batch.activatedCount).to.equal(1);
+    expect([MASViewConstraint installedConstraintsForView:view]).to.equal(newConstraints);
+
+    //the previous handles no longer control the kept constraints
+    [oldConstraints[0] uninstall];
+    expect(superview.constraints).to.haveCountOf(3);
+}
+
+- (void)testRemakeReplacesChangedConstraints {
+    MAS_VIEW *newView = MAS_VIEW.new;
+    [superview addSubview:newView];
+
+    maker.width.equalTo(newView).offset(10);
+    [maker install];
+
+    maker.removeExisting = YES;
+    maker.width.equalTo(newView).multipliedBy(2).offset(10);
+    [maker install];
+
+    expect(superview.constraints).to.haveCountOf(1);
+    NSLayoutConstraint *constraint = superview.constraints[0];
+    expect(constraint.multiplier).to.equal(2);
+    expect(maker.batch.deactivatedCount).to.equal(1);
+    expect(maker.batch.activatedCount).to.equal(1);
+}
+
+- (void)testInstallManyConstraints {
+    MAS_VIEW *newView = MAS_VIEW.new;
+    [superview addSubview:newView];
+
+    for (NSUInteger i = 0; i < 9; i++) {
+        maker.left.equalTo(newView).offset(i);
+    }
+    MASConstraint *viewConstraint = maker.width;
+    MASConstraint *sizeConstraint = viewConstraint.height;
+    sizeConstraint.equalTo(newView);
+    expect(maker.constraints.count).to.equal(10);
+    expect(maker.constraints[9]).to.beIdenticalTo(sizeConstraint);
+
+    NSArray *constraints = [maker install];
+    expect(constraints).to.haveCountOf(10);
+    expect(constraints.lastObject).to.beIdenticalTo(sizeConstraint);
+    expect(maker.constraints).to.haveCountOf(0);
+    expect(superview.constraints).to.haveCountOf(11);
+    expect([superview.constraints[8] constant]).to.equal(8);
+
+    maker.top.equalTo(newView);
+    expect([maker install]).to.haveCountOf(1);
+    expect(superview.constraints).to.haveCountOf(12);
+}
+
+- (void)testReplaceChainedConstraintAtItsIndex {
+    MASConstraint *left = maker.left;
+    MASConstraint *width = maker.width;
+    MASConstraint *top = maker.top;
+
+    composite = (id)width.height;
+    expect(maker.constraints).to.haveCountOf(3);
+    expect(maker.constraints[0]).to.beIdenticalTo(left);
+    expect(maker.constraints[1]).to.beIdenticalTo(composite);
+    expect(maker.constraints[2]).to.beIdenticalTo(top);
+
+    MASConstraint *replacement = top.equalTo(@[superview, @10]);
+    expect(maker.constraints[2]).to.beIdenticalTo(replacement);
+    expect(replacement.delegate).to.beIdenticalTo(maker);
+}
+
 - (void)testCreateNewViewAttributes {
     expect(maker.left).notTo.beIdenticalTo(maker.left);
     expect(maker.right).notTo.beIdenticalTo(maker.right);
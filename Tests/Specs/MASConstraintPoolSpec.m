@@ -0,0 +1,135 @@
+//
+//  MASConstraintPoolSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASConstraintPool.h"
+#import "MASConstraintPool+Private.h"
+#import "MASConstraintSignature.h"
+#import "MASViewConstraint.h"
+#import "MASViewConstraint+Private.h"
+#import "MASLayoutConstraint.h"
+#import "View+MASAdditions.h"
+
+SpecBegin(MASConstraintPool) {
+    MAS_VIEW *superview;
+    MAS_VIEW *view;
+}
+
+- (void)setUp {
+    MASConstraintPool.enabled = YES;
+    superview = MAS_VIEW.new;
+    view = MAS_VIEW.new;
+    [superview addSubview:view];
+}
+
+- (void)tearDown {
+    MASConstraintPool.enabled = NO;
+    MASConstraintPool.maximumCountPerView = 32;
+}
+
+- (void)testReusesUninstalledLayoutConstraint {
+    __block MASViewConstraint *width;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        width = (id)make.width.equalTo(@10);
+    }];
+    MASLayoutConstraint *layoutConstraint = width.layoutConstraint;
+    NSUInteger reuseCount = MASConstraintPool.reuseCount;
+
+    [width uninstall];
+    expect(width.layoutConstraint).to.beNil();
+    expect(layoutConstraint.active).to.beFalsy();
+
+    __block MASViewConstraint *newWidth;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        newWidth = (id)make.width.equalTo(@20);
+    }];
+    expect(newWidth.layoutConstraint).to.beIdenticalTo(layoutConstraint);
+    expect(layoutConstraint.constant).to.equal(20);
+    expect(layoutConstraint.active).to.beTruthy();
+    expect(MASConstraintPool.reuseCount - reuseCount).to.equal(1);
+
+    // the first handle is never repointed, installing it again needs another layout constraint
+    [width install];
+    expect(width.layoutConstraint).notTo.beNil();
+    expect(width.layoutConstraint).notTo.beIdenticalTo(layoutConstraint);
+    expect(newWidth.layoutConstraint).to.beIdenticalTo(layoutConstraint);
+}
+
+- (void)testDequeuesEnqueuedLayoutConstraint {
+    MASLayoutConstraint *layoutConstraint = [MASLayoutConstraint constraintWithItem:view
+                                                                          attribute:NSLayoutAttributeWidth
+                                                                          relatedBy:NSLayoutRelationEqual
+                                                                             toItem:nil
+                                                                          attribute:NSLayoutAttributeNotAnAttribute
+                                                                         multiplier:1
+                                                                           constant:10];
+    expect(MASConstraintPoolEnqueue(view, layoutConstraint)).to.beTruthy();
+
+    MASConstraintSignature *signature = [MASConstraintSignature signatureWithLayoutConstraint:layoutConstraint];
+    expect(MASConstraintPoolDequeue(view, signature)).to.beIdenticalTo(layoutConstraint);
+    expect(MASConstraintPoolDequeue(view, signature)).to.beNil();
+}
+
+- (void)testOnlyReusesMatchingStructure {
+    __block MASViewConstraint *width;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        width = (id)make.width.equalTo(@10);
+    }];
+    MASLayoutConstraint *layoutConstraint = width.layoutConstraint;
+    [width uninstall];
+
+    __block MASViewConstraint *lowWidth;
+    __block MASViewConstraint *height;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        lowWidth = (id)make.width.equalTo(@10).priorityLow();
+        height = (id)make.height.equalTo(@10);
+    }];
+    expect(lowWidth.layoutConstraint).notTo.beIdenticalTo(layoutConstraint);
+    expect(height.layoutConstraint).notTo.beIdenticalTo(layoutConstraint);
+}
+
+- (void)testRemakingBetweenLayoutsReusesConstraints {
+    void (^leading)(MASConstraintMaker *) = ^(MASConstraintMaker *make) {
+        make.left.top.equalTo(superview);
+    };
+    void (^trailing)(MASConstraintMaker *) = ^(MASConstraintMaker *make) {
+        make.right.bottom.equalTo(superview);
+    };
+
+    [view mas_makeConstraints:leading];
+    NSSet *leadingConstraints = [NSSet setWithArray:superview.constraints];
+    [view mas_remakeConstraints:trailing];
+    NSSet *trailingConstraints = [NSSet setWithArray:superview.constraints];
+    expect(trailingConstraints).to.haveCountOf(2);
+    expect([trailingConstraints intersectsSet:leadingConstraints]).to.beFalsy();
+
+    [view mas_remakeConstraints:leading];
+    expect([NSSet setWithArray:superview.constraints]).to.equal(leadingConstraints);
+    [view mas_remakeConstraints:trailing];
+    expect([NSSet setWithArray:superview.constraints]).to.equal(trailingConstraints);
+}
+
+- (void)testLimitsAndDrainsPools {
+    MASConstraintPool.maximumCountPerView = 1;
+    NSArray *constraints = [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.width.height.equalTo(@10);
+    }];
+    NSUInteger recycleCount = MASConstraintPool.recycleCount;
+    for (MASConstraint *constraint in constraints) {
+        [constraint uninstall];
+    }
+    expect(MASConstraintPool.recycleCount - recycleCount).to.equal(1);
+
+    [MASConstraintPool drain];
+    NSUInteger reuseCount = MASConstraintPool.reuseCount;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.width.height.equalTo(@10);
+    }];
+    expect(MASConstraintPool.reuseCount).to.equal(reuseCount);
+}
+
+SpecEnd
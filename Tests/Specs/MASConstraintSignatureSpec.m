@@ -0,0 +1,55 @@
+//
+//  MASConstraintSignatureSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASConstraintSignature.h"
+
+SpecBegin(MASConstraintSignature) {
+    MAS_VIEW *view;
+    MAS_VIEW *otherView;
+    NSLayoutConstraint *layoutConstraint;
+}
+
+- (void)setUp {
+    view = MAS_VIEW.new;
+    otherView = MAS_VIEW.new;
+    layoutConstraint = [NSLayoutConstraint constraintWithItem:view attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationEqual
+                                                       toItem:otherView attribute:NSLayoutAttributeRight multiplier:1 constant:10];
+}
+
+- (void)testIgnoresConstant {
+    NSLayoutConstraint *otherConstraint = [NSLayoutConstraint constraintWithItem:view attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationEqual
+                                                                          toItem:otherView attribute:NSLayoutAttributeRight multiplier:1 constant:20];
+
+    MASConstraintSignature *signature = [MASConstraintSignature signatureWithLayoutConstraint:layoutConstraint];
+    MASConstraintSignature *otherSignature = [MASConstraintSignature signatureWithLayoutConstraint:otherConstraint];
+    expect(signature).to.equal(otherSignature);
+    expect(signature.hash).to.equal(otherSignature.hash);
+}
+
+- (void)testComparesStructure {
+    MASConstraintSignature *signature = [MASConstraintSignature signatureWithLayoutConstraint:layoutConstraint];
+
+    NSLayoutConstraint *otherConstraint = [NSLayoutConstraint constraintWithItem:otherView attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationEqual
+                                                                          toItem:view attribute:NSLayoutAttributeRight multiplier:1 constant:10];
+    expect(signature).notTo.equal([MASConstraintSignature signatureWithLayoutConstraint:otherConstraint]);
+
+    otherConstraint = [NSLayoutConstraint constraintWithItem:view attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationGreaterThanOrEqual
+                                                      toItem:otherView attribute:NSLayoutAttributeRight multiplier:1 constant:10];
+    expect(signature).notTo.equal([MASConstraintSignature signatureWithLayoutConstraint:otherConstraint]);
+
+    otherConstraint = [NSLayoutConstraint constraintWithItem:view attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationEqual
+                                                      toItem:otherView attribute:NSLayoutAttributeRight multiplier:2 constant:10];
+    expect(signature).notTo.equal([MASConstraintSignature signatureWithLayoutConstraint:otherConstraint]);
+
+    otherConstraint = [NSLayoutConstraint constraintWithItem:view attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationEqual
+                                                      toItem:otherView attribute:NSLayoutAttributeRight multiplier:1 constant:10];
+    otherConstraint.priority = MASLayoutPriorityDefaultLow;
+    expect(signature).notTo.equal([MASConstraintSignature signatureWithLayoutConstraint:otherConstraint]);
+}
+
+SpecEnd
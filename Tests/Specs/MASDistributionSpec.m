@@ -0,0 +1,107 @@
+//
+//  MASDistributionSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASDistribution.h"
+#import "MASViewConstraint.h"
+#import "MASViewConstraint+Private.h"
+
+SpecBegin(MASDistribution) {
+    MAS_VIEW *superview;
+    NSArray *views;
+}
+
+- (void)setUp {
+    superview = [[MAS_VIEW alloc] initWithFrame:CGRectMake(0, 0, 320, 100)];
+    views = @[ MAS_VIEW.new, MAS_VIEW.new, MAS_VIEW.new ];
+    for (MAS_VIEW *view in views) {
+        [superview addSubview:view];
+        [view mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.top.bottom.equalTo(superview);
+        }];
+    }
+}
+
+- (NSArray *)layoutConstraintsOfDistribution:(MASDistribution *)distribution {
+    NSMutableArray *layoutConstraints = [NSMutableArray array];
+    for (MASViewConstraint *constraint in distribution.constraints) {
+        [layoutConstraints addObject:constraint.layoutConstraint];
+    }
+    return layoutConstraints;
+}
+
+- (CGFloat)minimumOfView:(NSUInteger)index {
+    [superview layoutIfNeeded];
+    return CGRectGetMinX([views[index] frame]);
+}
+
+- (CGFloat)maximumOfView:(NSUInteger)index {
+    [superview layoutIfNeeded];
+    return CGRectGetMaxX([views[index] frame]);
+}
+
+- (void)testRespacesFixedSpacingInPlace {
+    MASDistribution *distribution = [views mas_distributeViewsAlongAxis:MASAxisTypeHorizontal withFixedSpacing:0 leadSpacing:10 tailSpacing:10];
+    expect(distribution.type).to.equal(MASDistributionTypeFixedSpacing);
+    expect(distribution.constraints).to.haveCountOf(6);
+    expect([self maximumOfView:0]).to.beCloseTo(110);
+    NSArray *layoutConstraints = [self layoutConstraintsOfDistribution:distribution];
+
+    distribution.spacing = 15;
+    expect([self minimumOfView:0]).to.beCloseTo(10);
+    expect([self maximumOfView:0]).to.beCloseTo(100);
+    expect([self minimumOfView:1]).to.beCloseTo(115);
+    expect([self maximumOfView:2]).to.beCloseTo(310);
+
+    distribution.leadSpacing = 40;
+    distribution.tailSpacing = 0;
+    expect([self minimumOfView:0]).to.beCloseTo(40);
+    expect([self maximumOfView:2]).to.beCloseTo(320);
+
+    expect([self layoutConstraintsOfDistribution:distribution]).to.equal(layoutConstraints);
+}
+
+- (void)testRespacesFixedItemLengthInPlace {
+    MASDistribution *distribution = [views mas_distributeViewsAlongAxis:MASAxisTypeHorizontal withFixedItemLength:30 leadSpacing:10 tailSpacing:20];
+    expect(distribution.type).to.equal(MASDistributionTypeFixedItemLength);
+    expect([self minimumOfView:0]).to.beCloseTo(10);
+    expect([self maximumOfView:1]).to.beCloseTo(170);
+    expect([self maximumOfView:2]).to.beCloseTo(300);
+    NSArray *layoutConstraints = [self layoutConstraintsOfDistribution:distribution];
+
+    distribution.leadSpacing = 20;
+    distribution.itemLength = 40;
+    expect([self minimumOfView:0]).to.beCloseTo(20);
+    expect([self maximumOfView:0]).to.beCloseTo(60);
+    // the middle view stays centered between its neighbours
+    expect([self minimumOfView:1]).to.beCloseTo(140);
+    expect([self maximumOfView:1]).to.beCloseTo(180);
+    expect([self minimumOfView:2]).to.beCloseTo(260);
+
+    distribution.tailSpacing = 0;
+    expect([self maximumOfView:1]).to.beCloseTo(190);
+    expect([self maximumOfView:2]).to.beCloseTo(320);
+
+    expect([self layoutConstraintsOfDistribution:distribution]).to.equal(layoutConstraints);
+}
+
+- (void)testRejectsMetricOfOtherType {
+    MASDistribution *distribution = [views mas_distributeViewsAlongAxis:MASAxisTypeHorizontal withFixedSpacing:0 leadSpacing:0 tailSpacing:0];
+    expect(^{
+        distribution.itemLength = 10;
+    }).to.raiseAny();
+}
+
+- (void)testUninstall {
+    MASDistribution *distribution = [views mas_distributeViewsAlongAxis:MASAxisTypeHorizontal withFixedItemLength:30 leadSpacing:10 tailSpacing:20];
+    [distribution uninstall];
+
+    expect(distribution.constraints).to.haveCountOf(0);
+    expect([MASViewConstraint installedConstraintsForView:views[1]]).to.haveCountOf(2);
+}
+
+SpecEnd
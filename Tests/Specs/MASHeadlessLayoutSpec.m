@@ -0,0 +1,134 @@
+//
+//  MASHeadlessLayoutSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASHeadlessLayout.h"
+#import "View+MASAdditions.h"
+
+SpecBegin(MASHeadlessLayout) {
+    MAS_VIEW *superview;
+    MAS_VIEW *header;
+    MAS_VIEW *body;
+    MAS_VIEW *badge;
+}
+
+- (void)setUp {
+    superview = [[MAS_VIEW alloc] initWithFrame:CGRectMake(0, 0, 320, 480)];
+    header = MAS_VIEW.new;
+    body = MAS_VIEW.new;
+    badge = MAS_VIEW.new;
+    [superview addSubview:header];
+    [superview addSubview:body];
+    [header addSubview:badge];
+
+    [header mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.top.left.right.equalTo(superview).insets(MASEdgeInsetsMake(20, 10, 0, 10));
+        make.height.equalTo(@44);
+    }];
+    [body mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.top.equalTo(header.mas_bottom).offset(8);
+        make.left.right.equalTo(header);
+        make.height.equalTo(header).multipliedBy(2).priorityLow();
+        make.height.lessThanOrEqualTo(@60);
+    }];
+    [badge mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.centerY.equalTo(header);
+        make.right.equalTo(header).offset(-4);
+        make.size.equalTo(@24);
+    }];
+}
+
+- (void)testMatchesLayoutEngine {
+    MASHeadlessLayout *layout = [[MASHeadlessLayout alloc] initWithView:superview];
+    [layout layoutWithSize:superview.bounds.size];
+    [superview layoutIfNeeded];
+
+    expect(layout.unsupportedConstraintCount).to.equal(0);
+    expect(layout.unsatisfiableConstraintCount).to.equal(0);
+    for (MAS_VIEW *view in @[header, body, badge]) {
+        expect(NSStringFromCGRect([layout frameForView:view])).to.equal(NSStringFromCGRect(view.frame));
+    }
+}
+
+- (void)testLayoutOffMainThread {
+    MASHeadlessLayout *layout = [[MASHeadlessLayout alloc] initWithView:superview];
+
+    __block CGRect frame = CGRectZero;
+    dispatch_sync(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        [layout layoutWithSize:CGSizeMake(200, -1)];
+        frame = [layout frameForView:body];
+    });
+
+    expect(frame.size.width).to.equal(180);
+    expect(frame.size.height).to.equal(60);
+    expect(CGRectIsNull([layout frameForView:MAS_VIEW.new])).to.beTruthy();
+}
+
+- (void)testUpdatingConstants {
+    __block MASConstraint *badgeRight;
+    [badge mas_remakeConstraints:^(MASConstraintMaker *make) {
+        make.centerY.equalTo(header);
+        badgeRight = make.right.equalTo(header).offset(-4);
+        make.size.equalTo(@24);
+    }];
+    MASHeadlessLayout *layout = [[MASHeadlessLayout alloc] initWithView:superview];
+    [layout layoutWithSize:superview.bounds.size];
+
+    badgeRight.offset(-40);
+    expect([layout updateConstantsOfConstraint:badgeRight]).to.beTruthy();
+    [superview layoutIfNeeded];
+    expect(NSStringFromCGRect([layout frameForView:badge])).to.equal(NSStringFromCGRect(badge.frame));
+
+    MASConstraint *uncaptured = [body mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.width.greaterThanOrEqualTo(@10);
+    }].firstObject;
+    expect([layout updateConstantsOfConstraint:uncaptured]).to.beFalsy();
+}
+
+- (void)testFittingSizeMatchesLayoutEngine {
+    UIView *contentView = UIView.new;
+    UILabel *titleLabel = UILabel.new;
+    UILabel *detailLabel = UILabel.new;
+    [contentView addSubview:titleLabel];
+    [contentView addSubview:detailLabel];
+    [titleLabel mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.top.left.equalTo(contentView).offset(12);
+        make.right.lessThanOrEqualTo(contentView).offset(-12);
+    }];
+    [detailLabel mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.top.equalTo(titleLabel.mas_bottom).offset(4);
+        make.left.equalTo(titleLabel);
+        make.right.lessThanOrEqualTo(contentView).offset(-12);
+        make.bottom.equalTo(contentView).offset(-12);
+    }];
+
+    // captured once with empty labels, then sized per row off the main thread
+    MASHeadlessLayout *layout = [[MASHeadlessLayout alloc] initWithView:contentView];
+    NSArray *rows = @[ @[@"Title", @"Detail"], @[@"A longer title", @""], @[@"", @"Only detail"] ];
+    for (NSArray *row in rows) {
+        titleLabel.text = row[0];
+        detailLabel.text = row[1];
+        CGSize titleSize = titleLabel.intrinsicContentSize;
+        CGSize detailSize = detailLabel.intrinsicContentSize;
+        CGSize expectedSize = [contentView systemLayoutSizeFittingSize:CGSizeMake(320, 0)
+                                         withHorizontalFittingPriority:UILayoutPriorityRequired
+                                               verticalFittingPriority:UILayoutPriorityFittingSizeLevel];
+
+        __block CGSize size = CGSizeZero;
+        dispatch_sync(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+            [layout setIntrinsicContentSize:titleSize forView:titleLabel];
+            [layout setIntrinsicContentSize:detailSize forView:detailLabel];
+            size = [layout fittingSizeForTargetSize:CGSizeMake(320, 0)
+                          horizontalFittingPriority:MASLayoutPriorityRequired
+                            verticalFittingPriority:MASLayoutPriorityFittingSizeLevel];
+        });
+        expect(NSStringFromCGSize(size)).to.equal(NSStringFromCGSize(expectedSize));
+    }
+    expect(layout.unsatisfiableConstraintCount).to.equal(0);
+}
+
+SpecEnd
@@ -0,0 +1,187 @@
+//
+//  MASLayoutSolverSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASLayoutSolver.h"
+#import "MASLayoutTree.h"
+
+SpecBegin(MASLayoutSolver) {
+    MASLayoutSolver *solver;
+}
+
+- (void)setUp {
+    solver = MASLayoutSolverCreate();
+}
+
+- (void)tearDown {
+    MASLayoutSolverDestroy(solver);
+}
+
+- (void)testRequiredConstraints {
+    MASLayoutVariable x = MASLayoutSolverAddVariable(solver);
+    MASLayoutVariable y = MASLayoutSolverAddVariable(solver);
+
+    // x == 10, y >= x + 5
+    MASLayoutSolverTerm fixX[] = { { x, 1 } };
+    MASLayoutSolverTerm yAfterX[] = { { y, 1 }, { x, -1 } };
+    expect(MASLayoutSolverAddConstraint(solver, fixX, 1, -10, MASLayoutSolverRelationEqual, MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED, NULL)).to.equal(MASLayoutSolverStatusOK);
+    expect(MASLayoutSolverAddConstraint(solver, yAfterX, 2, -5, MASLayoutSolverRelationGreaterThanOrEqual, MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED, NULL)).to.equal(MASLayoutSolverStatusOK);
+
+    expect(MASLayoutSolverValue(solver, x)).to.equal(10);
+    expect(MASLayoutSolverValue(solver, y)).to.beGreaterThanOrEqualTo(15);
+}
+
+- (void)testConflictingRequiredConstraintLeavesSolverUnchanged {
+    MASLayoutVariable x = MASLayoutSolverAddVariable(solver);
+    MASLayoutSolverTerm terms[] = { { x, 1 } };
+    MASLayoutSolverAddConstraint(solver, terms, 1, -10, MASLayoutSolverRelationEqual, MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED, NULL);
+
+    MASLayoutSolverConstraint constraint;
+    expect(MASLayoutSolverAddConstraint(solver, terms, 1, -20, MASLayoutSolverRelationEqual, MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED, &constraint)).to.equal(MASLayoutSolverStatusUnsatisfiable);
+    expect(constraint).to.equal(MASLayoutSolverConstraintInvalid);
+    expect(MASLayoutSolverValue(solver, x)).to.equal(10);
+    expect(MASLayoutSolverConstraintCount(solver)).to.equal(1);
+}
+
+- (void)testHigherPriorityWins {
+    MASLayoutVariable x = MASLayoutSolverAddVariable(solver);
+    MASLayoutSolverTerm terms[] = { { x, 1 } };
+    MASLayoutSolverAddConstraint(solver, terms, 1, -10, MASLayoutSolverRelationEqual, MASLayoutSolverStrengthForPriority(250), NULL);
+
+    MASLayoutSolverConstraint high;
+    MASLayoutSolverAddConstraint(solver, terms, 1, -100, MASLayoutSolverRelationEqual, MASLayoutSolverStrengthForPriority(750), &high);
+    expect(MASLayoutSolverValue(solver, x)).to.equal(100);
+
+    expect(MASLayoutSolverRemoveConstraint(solver, high)).to.equal(MASLayoutSolverStatusOK);
+    expect(MASLayoutSolverValue(solver, x)).to.equal(10);
+    expect(MASLayoutSolverRemoveConstraint(solver, high)).to.equal(MASLayoutSolverStatusInvalidHandle);
+}
+
+- (void)testSetConstantReoptimizes {
+    MASLayoutVariable x = MASLayoutSolverAddVariable(solver);
+    MASLayoutSolverTerm terms[] = { { x, 1 } };
+
+    // x == 10, x <= 20
+    MASLayoutSolverConstraint fixX;
+    MASLayoutSolverAddConstraint(solver, terms, 1, -10, MASLayoutSolverRelationEqual, MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED, &fixX);
+    MASLayoutSolverAddConstraint(solver, terms, 1, -20, MASLayoutSolverRelationLessThanOrEqual, MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED, NULL);
+
+    expect(MASLayoutSolverSetConstant(solver, fixX, -15)).to.equal(MASLayoutSolverStatusOK);
+    expect(MASLayoutSolverConstant(solver, fixX)).to.equal(-15);
+    expect(MASLayoutSolverValue(solver, x)).to.equal(15);
+
+    expect(MASLayoutSolverSetConstant(solver, fixX, -30)).to.equal(MASLayoutSolverStatusUnsatisfiable);
+    expect(MASLayoutSolverConstant(solver, fixX)).to.equal(-15);
+    expect(MASLayoutSolverValue(solver, x)).to.equal(15);
+}
+
+- (void)testSuggestedValuesRespectRequiredConstraints {
+    MASLayoutVariable x = MASLayoutSolverAddVariable(solver);
+    MASLayoutVariable y = MASLayoutSolverAddVariable(solver);
+
+    // y >= x + 10, y <= 100
+    MASLayoutSolverTerm yAfterX[] = { { y, 1 }, { x, -1 } };
+    MASLayoutSolverTerm yTerms[] = { { y, 1 } };
+    MASLayoutSolverAddConstraint(solver, yAfterX, 2, -10, MASLayoutSolverRelationGreaterThanOrEqual, MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED, NULL);
+    MASLayoutSolverAddConstraint(solver, yTerms, 1, -100, MASLayoutSolverRelationLessThanOrEqual, MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED, NULL);
+
+    expect(MASLayoutSolverAddEditVariable(solver, x, MAS_LAYOUT_SOLVER_STRENGTH_REQUIRED)).to.equal(MASLayoutSolverStatusOK);
+    expect(MASLayoutSolverSuggestValue(solver, x, 40)).to.equal(MASLayoutSolverStatusOK);
+    expect(MASLayoutSolverValue(solver, x)).to.equal(40);
+    expect(MASLayoutSolverValue(solver, y)).to.beGreaterThanOrEqualTo(50);
+
+    expect(MASLayoutSolverSuggestValue(solver, x, 200)).to.equal(MASLayoutSolverStatusOK);
+    expect(MASLayoutSolverValue(solver, x)).to.equal(90);
+
+    expect(MASLayoutSolverRemoveEditVariable(solver, x)).to.equal(MASLayoutSolverStatusOK);
+    expect(MASLayoutSolverSuggestValue(solver, x, 10)).to.equal(MASLayoutSolverStatusInvalidHandle);
+}
+
+- (void)testTreeFrames {
+    MASLayoutTree *tree = MASLayoutTreeCreate();
+    MASLayoutItem item = MASLayoutTreeAddItem(tree, MASLayoutItemRoot);
+    MASLayoutItem child = MASLayoutTreeAddItem(tree, item);
+    MASLayoutTreeSetRootSize(tree, 320, MAS_LAYOUT_TREE_NO_METRIC);
+
+    // item.edges.equalTo(root).insets(10) with a fixed height, child.center.equalTo(item) with an intrinsic size
+    MASLayoutTreeConstraint constraints[] = {
+        { item, MASLayoutTreeAttributeLeft, MASLayoutSolverRelationEqual, MASLayoutItemRoot, MASLayoutTreeAttributeLeft, 1, 10, 1000 },
+        { item, MASLayoutTreeAttributeRight, MASLayoutSolverRelationEqual, MASLayoutItemRoot, MASLayoutTreeAttributeRight, 1, -10, 1000 },
+        { item, MASLayoutTreeAttributeTop, MASLayoutSolverRelationEqual, MASLayoutItemRoot, MASLayoutTreeAttributeTop, 1, 10, 1000 },
+        { item, MASLayoutTreeAttributeHeight, MASLayoutSolverRelationEqual, MASLayoutItemNone, MASLayoutTreeAttributeNone, 1, 100, 1000 },
+        { MASLayoutItemRoot, MASLayoutTreeAttributeBottom, MASLayoutSolverRelationEqual, item, MASLayoutTreeAttributeBottom, 1, 10, 1000 },
+        { child, MASLayoutTreeAttributeCenterX, MASLayoutSolverRelationEqual, item, MASLayoutTreeAttributeCenterX, 1, 0, 1000 },
+        { child, MASLayoutTreeAttributeCenterY, MASLayoutSolverRelationEqual, item, MASLayoutTreeAttributeCenterY, 1, 0, 1000 },
+    };
+    for (size_t i = 0; i < sizeof(constraints) / sizeof(constraints[0]); i++) {
+        expect(MASLayoutTreeAddConstraint(tree, &constraints[i], NULL)).to.equal(MASLayoutSolverStatusOK);
+    }
+    MASLayoutTreeSetIntrinsicSize(tree, child, 40, 20);
+
+    MASLayoutRect rootFrame = MASLayoutTreeFrame(tree, MASLayoutItemRoot);
+    MASLayoutRect itemFrame = MASLayoutTreeFrame(tree, item);
+    MASLayoutRect childFrame = MASLayoutTreeFrame(tree, child);
+    expect(rootFrame.height).to.equal(120);
+    expect(itemFrame.x).to.equal(10);
+    expect(itemFrame.width).to.equal(300);
+    expect(childFrame.x).to.equal(130);
+    expect(childFrame.y).to.equal(40);
+    expect(childFrame.width).to.equal(40);
+
+    MASLayoutTreeDestroy(tree);
+}
+
+- (void)testTreeRejectsUnsupportedAttributes {
+    MASLayoutTree *tree = MASLayoutTreeCreate();
+    MASLayoutItem item = MASLayoutTreeAddItem(tree, MASLayoutItemRoot);
+
+    MASLayoutTreeConstraint baseline = { item, NSLayoutAttributeBaseline, MASLayoutSolverRelationEqual, MASLayoutItemRoot, NSLayoutAttributeBaseline, 1, 0, 1000 };
+    expect(MASLayoutTreeAddConstraint(tree, &baseline, NULL)).to.equal(MASLayoutSolverStatusUnsupported);
+
+    MASLayoutTreeDestroy(tree);
+}
+
+- (void)testAnimatingConstantsPerformance {
+    // a row of 200 items, all spacings change every frame like an animated offset
+    MASLayoutTree *tree = MASLayoutTreeCreate();
+    MASLayoutTreeSetRootSize(tree, 10000, 100);
+
+    const int count = 200;
+    MASLayoutSolverConstraint *spacings = calloc(count, sizeof(MASLayoutSolverConstraint));
+    MASLayoutItem previous = MASLayoutItemRoot;
+    for (int i = 0; i < count; i++) {
+        MASLayoutItem item = MASLayoutTreeAddItem(tree, MASLayoutItemRoot);
+        MASLayoutTreeConstraint constraints[] = {
+            { item, MASLayoutTreeAttributeLeft, MASLayoutSolverRelationEqual, previous, previous == MASLayoutItemRoot ? MASLayoutTreeAttributeLeft : MASLayoutTreeAttributeRight, 1, 2, 1000 },
+            { item, MASLayoutTreeAttributeWidth, MASLayoutSolverRelationEqual, MASLayoutItemNone, MASLayoutTreeAttributeNone, 1, 20, 1000 },
+            { item, MASLayoutTreeAttributeTop, MASLayoutSolverRelationEqual, MASLayoutItemRoot, MASLayoutTreeAttributeTop, 1, 0, 1000 },
+            { item, MASLayoutTreeAttributeHeight, MASLayoutSolverRelationEqual, MASLayoutItemRoot, MASLayoutTreeAttributeHeight, 1, 0, 1000 },
+        };
+        MASLayoutTreeAddConstraint(tree, &constraints[0], &spacings[i]);
+        for (size_t j = 1; j < sizeof(constraints) / sizeof(constraints[0]); j++) {
+            MASLayoutTreeAddConstraint(tree, &constraints[j], NULL);
+        }
+        previous = item;
+    }
+
+    __block int frame = 0;
+    [self measureBlock:^{
+        for (int i = 0; i < 60; i++, frame++) {
+            for (int j = 0; j < count; j++) {
+                MASLayoutTreeSetConstant(tree, spacings[j], 2 + (frame % 10));
+            }
+        }
+    }];
+
+    MASLayoutRect last = MASLayoutTreeFrame(tree, previous);
+    expect(last.x).to.equal(count * (2 + (frame - 1) % 10) + (count - 1) * 20);
+
+    free(spacings);
+    MASLayoutTreeDestroy(tree);
+}
+
+SpecEnd
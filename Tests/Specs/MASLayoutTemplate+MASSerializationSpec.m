@@ -0,0 +1,150 @@
+//
+//  MASLayoutTemplate+MASSerializationSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASLayoutTemplate+MASSerialization.h"
+#import "MASLayoutTemplateBuilder.h"
+#import "MASLayoutConstraint.h"
+#import "MASViewConstraint.h"
+#import "MASViewConstraint+Private.h"
+#import "View+MASAdditions.h"
+
+SpecBegin(MASLayoutTemplate_MASSerialization) {
+    MAS_VIEW *container;
+    MAS_VIEW *title;
+    MAS_VIEW *icon;
+    NSArray *madeConstraints;
+    MASLayoutTemplate *layoutTemplate;
+}
+
+- (void)setUp {
+    container = MAS_VIEW.new;
+    title = MAS_VIEW.new;
+    icon = MAS_VIEW.new;
+    [container addSubview:title];
+    [container addSubview:icon];
+
+    layoutTemplate = [MASLayoutTemplate templateWithViews:@[container, title, icon] recording:^{
+        [icon mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.left.top.equalTo(@8);
+            make.size.equalTo(@40).priorityHigh();
+        }];
+        [title mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.left.equalTo(icon.mas_right).offset(8.5).key(@"titleLeft");
+            make.right.lessThanOrEqualTo(container).offset(-8);
+            make.width.equalTo(icon).multipliedBy(2.25);
+            make.centerY.equalTo(icon);
+        }];
+    }];
+
+    // the template records constraints in the order they were installed
+    NSMutableArray *constraints = [NSMutableArray array];
+    for (MAS_VIEW *view in @[icon, title]) {
+        for (MASViewConstraint *constraint in [MASViewConstraint installedConstraintsForView:view]) {
+            [constraints addObject:constraint.layoutConstraint];
+        }
+    }
+    madeConstraints = constraints;
+}
+
+- (void)testRoundTripsTheMakerOutput {
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"MASLayoutTemplateSpec.masl"];
+    NSError *error = nil;
+    expect([layoutTemplate writeToFile:path error:&error]).to.beTruthy();
+
+    MASLayoutTemplate *loadedTemplate = [MASLayoutTemplate templateWithContentsOfFile:path error:&error];
+    expect(error).to.beNil();
+    expect(loadedTemplate.slotCount).to.equal(3);
+    expect(loadedTemplate.entryCount).to.equal(layoutTemplate.entryCount);
+    expect(loadedTemplate.keys).to.equal(layoutTemplate.keys);
+
+    MAS_VIEW *newContainer = MAS_VIEW.new;
+    MAS_VIEW *newTitle = MAS_VIEW.new;
+    MAS_VIEW *newIcon = MAS_VIEW.new;
+    [newContainer addSubview:newTitle];
+    [newContainer addSubview:newIcon];
+    NSArray *views = @[container, title, icon];
+    NSArray *newViews = @[newContainer, newTitle, newIcon];
+    NSArray *constraints = [loadedTemplate installOnViews:newViews];
+
+    expect(constraints).to.haveCountOf(madeConstraints.count);
+    for (NSUInteger i = 0; i < constraints.count; i++) {
+        MASLayoutConstraint *constraint = constraints[i];
+        MASLayoutConstraint *madeConstraint = madeConstraints[i];
+        expect(constraint.firstItem).to.beIdenticalTo(newViews[[views indexOfObjectIdenticalTo:madeConstraint.firstItem]]);
+        if (madeConstraint.secondItem) {
+            expect(constraint.secondItem).to.beIdenticalTo(newViews[[views indexOfObjectIdenticalTo:madeConstraint.secondItem]]);
+        } else {
+            expect(constraint.secondItem).to.beNil();
+        }
+        expect(constraint.firstAttribute).to.equal(madeConstraint.firstAttribute);
+        expect(constraint.secondAttribute).to.equal(madeConstraint.secondAttribute);
+        expect(constraint.relation).to.equal(madeConstraint.relation);
+        expect(constraint.multiplier).to.equal(madeConstraint.multiplier);
+        expect(constraint.constant).to.equal(madeConstraint.constant);
+        expect(constraint.priority).to.equal(madeConstraint.priority);
+        expect(constraint.mas_key).to.equal(madeConstraint.mas_key);
+    }
+    [NSFileManager.defaultManager removeItemAtPath:path error:NULL];
+}
+
+- (void)testRoundTripsTokens {
+    MASLayoutTemplateBuilder *builder = [MASLayoutTemplateBuilder new];
+    [builder constrainToken:@"icon" attribute:NSLayoutAttributeLeft equalToToken:nil constant:8];
+    [builder constrainToken:@"title" attribute:NSLayoutAttributeLeft equalToToken:@"icon" constant:8];
+
+    MASLayoutTemplate *loadedTemplate = [MASLayoutTemplate templateWithData:[builder build].dataRepresentation error:NULL];
+    expect(loadedTemplate.tokens).to.equal((@[@"icon", @"title"]));
+    expect(loadedTemplate.keys).to.beNil();
+    expect(loadedTemplate.entries[0].secondSlot).to.equal(MASLayoutTemplateSlotSuperview);
+}
+
+- (void)testRejectsCorruptAndNewerData {
+    NSMutableData *data = [layoutTemplate.dataRepresentation mutableCopy];
+    NSError *error = nil;
+
+    NSData *truncatedData = [data subdataWithRange:NSMakeRange(0, data.length - 1)];
+    expect([MASLayoutTemplate templateWithData:truncatedData error:&error]).to.beNil();
+    expect(error.code).to.equal(MASLayoutTemplateErrorCorruptData);
+
+    uint16_t version = CFSwapInt16HostToLittle(MASLayoutTemplateFormatVersion + 1);
+    [data replaceBytesInRange:NSMakeRange(4, sizeof(version)) withBytes:&version];
+    expect([MASLayoutTemplate templateWithData:data error:&error]).to.beNil();
+    expect(error.code).to.equal(MASLayoutTemplateErrorUnsupportedVersion);
+}
+
+- (void)testRejectsAttributesThatCannotBeInstalled {
+    NSData *data = layoutTemplate.dataRepresentation;
+    // the first entry follows the 24 byte header, its first attribute follows both slots
+    NSRange firstAttributeRange = NSMakeRange(24 + 8, sizeof(uint32_t));
+    NSError *error = nil;
+
+    NSMutableData *unknownAttributeData = [data mutableCopy];
+    uint32_t attribute = CFSwapInt32HostToLittle(99);
+    [unknownAttributeData replaceBytesInRange:firstAttributeRange withBytes:&attribute];
+    expect([MASLayoutTemplate templateWithData:unknownAttributeData error:&error]).to.beNil();
+    expect(error.code).to.equal(MASLayoutTemplateErrorCorruptData);
+
+    // left of the superview related to its height
+    NSMutableData *mismatchedAttributeData = [data mutableCopy];
+    attribute = CFSwapInt32HostToLittle(NSLayoutAttributeHeight);
+    [mismatchedAttributeData replaceBytesInRange:NSMakeRange(24 + 12, sizeof(uint32_t)) withBytes:&attribute];
+    error = nil;
+    expect([MASLayoutTemplate templateWithData:mismatchedAttributeData error:&error]).to.beNil();
+    expect(error.code).to.equal(MASLayoutTemplateErrorCorruptData);
+
+    // the width of the icon is a constant, a second attribute without a second item is inconsistent
+    NSMutableData *constantWithAttributeData = [data mutableCopy];
+    attribute = CFSwapInt32HostToLittle(NSLayoutAttributeWidth);
+    NSUInteger widthEntryOffset = 24 + 2 * 48;
+    [constantWithAttributeData replaceBytesInRange:NSMakeRange(widthEntryOffset + 12, sizeof(uint32_t)) withBytes:&attribute];
+    error = nil;
+    expect([MASLayoutTemplate templateWithData:constantWithAttributeData error:&error]).to.beNil();
+    expect(error.code).to.equal(MASLayoutTemplateErrorCorruptData);
+}
+
+SpecEnd
@@ -0,0 +1,94 @@
+//
+//  MASLayoutTemplateBuilderSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASLayoutTemplateBuilder.h"
+#import "MASLayoutConstraint.h"
+#import "View+MASAdditions.h"
+
+SpecBegin(MASLayoutTemplateBuilder) {
+    MAS_VIEW *container;
+    MAS_VIEW *title;
+    MAS_VIEW *icon;
+}
+
+- (void)setUp {
+    container = MAS_VIEW.new;
+    title = MAS_VIEW.new;
+    icon = MAS_VIEW.new;
+    [container addSubview:title];
+    [container addSubview:icon];
+}
+
+- (MASLayoutTemplate *)buildTemplate {
+    MASLayoutTemplateBuilder *builder = [MASLayoutTemplateBuilder new];
+    [builder constrainToken:@"icon" attribute:NSLayoutAttributeLeft equalToToken:nil constant:8];
+    [builder constrainToken:@"icon" attribute:NSLayoutAttributeTop equalToToken:nil constant:8];
+    [builder constrainToken:@"icon" attribute:NSLayoutAttributeWidth equalToConstant:40];
+    [builder constrainToken:@"icon" attribute:NSLayoutAttributeHeight equalToConstant:40];
+    [builder constrainToken:@"title" attribute:NSLayoutAttributeLeft relatedBy:NSLayoutRelationEqual
+                    toToken:@"icon" attribute:NSLayoutAttributeRight
+                 multiplier:1 constant:8 priority:MASLayoutPriorityRequired key:@"titleLeft"];
+    [builder constrainToken:@"title" attribute:NSLayoutAttributeCenterY equalToToken:@"icon" constant:0];
+    return [builder build];
+}
+
+- (void)testBuildsOffTheMainThread {
+    __block MASLayoutTemplate *layoutTemplate;
+    dispatch_sync(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        layoutTemplate = [self buildTemplate];
+    });
+
+    expect(layoutTemplate.tokens).to.equal((@[@"icon", @"title"]));
+    expect(layoutTemplate.slotCount).to.equal(2);
+    expect(layoutTemplate.entryCount).to.equal(6);
+    expect(layoutTemplate.entries[0].secondSlot).to.equal(MASLayoutTemplateSlotSuperview);
+    expect(layoutTemplate.entries[0].secondAttribute).to.equal(NSLayoutAttributeLeft);
+    expect(layoutTemplate.entries[2].secondSlot).to.equal(MASLayoutTemplateSlotNone);
+    expect(layoutTemplate.entries[4].secondSlot).to.equal(0);
+    expect(layoutTemplate.keys[4]).to.equal(@"titleLeft");
+    expect(layoutTemplate.keys[5]).to.equal(NSNull.null);
+}
+
+- (void)testInstallsLikeTheEquivalentMaker {
+    NSArray *constraints = [[self buildTemplate] installOnViewsForTokens:@{ @"title": title, @"icon": icon }];
+
+    MAS_VIEW *otherContainer = MAS_VIEW.new;
+    MAS_VIEW *otherTitle = MAS_VIEW.new;
+    MAS_VIEW *otherIcon = MAS_VIEW.new;
+    [otherContainer addSubview:otherTitle];
+    [otherContainer addSubview:otherIcon];
+    MASLayoutTemplate *recordedTemplate = [MASLayoutTemplate templateWithViews:@[otherIcon, otherTitle] recording:^{
+        [otherIcon mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.left.top.equalTo(@8);
+            make.size.equalTo(@40);
+        }];
+        [otherTitle mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.left.equalTo(otherIcon.mas_right).offset(8).key(@"titleLeft");
+            make.centerY.equalTo(otherIcon);
+        }];
+    }];
+
+    expect(constraints).to.haveCountOf(recordedTemplate.entryCount);
+    for (NSUInteger i = 0; i < constraints.count; i++) {
+        MASLayoutConstraint *constraint = constraints[i];
+        const MASLayoutTemplateEntry *entry = &recordedTemplate.entries[i];
+        MAS_VIEW *firstView = entry->firstSlot == 0 ? icon : title;
+        expect(constraint.firstItem).to.beIdenticalTo(firstView);
+        expect(constraint.firstAttribute).to.equal(entry->firstAttribute);
+        expect(constraint.secondAttribute).to.equal(entry->secondAttribute);
+        expect(constraint.constant).to.equal(entry->constant);
+        expect(constraint.priority).to.equal(entry->priority);
+        expect(constraint.mas_key ?: NSNull.null).to.equal(recordedTemplate.keys ? recordedTemplate.keys[i] : NSNull.null);
+    }
+    expect([constraints[0] secondItem]).to.beIdenticalTo(container);
+    expect([constraints[4] secondItem]).to.beIdenticalTo(icon);
+    expect(container.constraints).to.haveCountOf(4);
+    expect(title.translatesAutoresizingMaskIntoConstraints).to.beFalsy();
+}
+
+SpecEnd
@@ -0,0 +1,138 @@
+//
+//  MASLayoutTemplateSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASLayoutTemplate.h"
+#import "MASLayoutConstraint.h"
+#import "MASViewConstraint.h"
+#import "View+MASAdditions.h"
+
+SpecBegin(MASLayoutTemplate) {
+    MAS_VIEW *container;
+    MAS_VIEW *title;
+    MAS_VIEW *icon;
+    MASLayoutTemplate *layoutTemplate;
+    NSUInteger blockCount;
+}
+
+- (void)setUp {
+    container = MAS_VIEW.new;
+    title = MAS_VIEW.new;
+    icon = MAS_VIEW.new;
+    [container addSubview:title];
+    [container addSubview:icon];
+    blockCount = 0;
+
+    layoutTemplate = [MASLayoutTemplate templateWithViews:@[container, title, icon] recording:^{
+        [icon mas_makeConstraints:^(MASConstraintMaker *make) {
+            blockCount++;
+            make.left.top.equalTo(@8);
+            make.size.equalTo(@40).priorityHigh();
+        }];
+        [title mas_makeConstraints:^(MASConstraintMaker *make) {
+            blockCount++;
+            make.left.equalTo(icon.mas_right).offset(8).key(@"titleLeft");
+            make.right.lessThanOrEqualTo(container).offset(-8);
+            make.centerY.equalTo(icon);
+        }];
+    }];
+}
+
+- (void)testRecordsEntriesWithSlots {
+    expect(blockCount).to.equal(2);
+    expect(layoutTemplate.slotCount).to.equal(3);
+    expect(layoutTemplate.entryCount).to.equal(7);
+    expect(container.constraints).to.haveCountOf(5);
+
+    const MASLayoutTemplateEntry *entry = &layoutTemplate.entries[0];
+    expect(entry->firstSlot).to.equal(2);
+    expect(entry->firstAttribute).to.equal(NSLayoutAttributeLeft);
+    expect(entry->secondSlot).to.equal(0);
+    expect(entry->constant).to.equal(8);
+
+    entry = &layoutTemplate.entries[2];
+    expect(entry->firstAttribute).to.equal(NSLayoutAttributeWidth);
+    expect(entry->secondSlot).to.equal(MASLayoutTemplateSlotNone);
+    expect(entry->priority).to.equal(MASLayoutPriorityDefaultHigh);
+
+    entry = &layoutTemplate.entries[4];
+    expect(entry->firstSlot).to.equal(1);
+    expect(entry->secondSlot).to.equal(2);
+    expect(entry->secondAttribute).to.equal(NSLayoutAttributeRight);
+    expect(layoutTemplate.keys[4]).to.equal(@"titleLeft");
+    expect(layoutTemplate.keys[5]).to.equal(NSNull.null);
+}
+
+- (void)testInstallsWithoutRunningBlocks {
+    MAS_VIEW *newContainer = MAS_VIEW.new;
+    MAS_VIEW *newTitle = MAS_VIEW.new;
+    MAS_VIEW *newIcon = MAS_VIEW.new;
+    [newContainer addSubview:newTitle];
+    [newContainer addSubview:newIcon];
+
+    NSArray *constraints = [layoutTemplate installOnViews:@[newContainer, newTitle, newIcon]];
+
+    expect(blockCount).to.equal(2);
+    expect(constraints).to.haveCountOf(7);
+    expect(newContainer.constraints).to.haveCountOf(5);
+    expect(newIcon.constraints).to.haveCountOf(2);
+    expect(newTitle.translatesAutoresizingMaskIntoConstraints).to.beFalsy();
+    expect(newIcon.translatesAutoresizingMaskIntoConstraints).to.beFalsy();
+
+    MASLayoutConstraint *constraint = constraints[4];
+    expect(constraint.firstItem).to.beIdenticalTo(newTitle);
+    expect(constraint.secondItem).to.beIdenticalTo(newIcon);
+    expect(constraint.constant).to.equal(8);
+    expect(constraint.mas_key).to.equal(@"titleLeft");
+
+    constraint = constraints[0];
+    expect(constraint.secondItem).to.beIdenticalTo(newContainer);
+}
+
+- (void)testInstalledConstraintsCanBeUpdatedAndRemade {
+    MAS_VIEW *newContainer = MAS_VIEW.new;
+    MAS_VIEW *newTitle = MAS_VIEW.new;
+    MAS_VIEW *newIcon = MAS_VIEW.new;
+    [newContainer addSubview:newTitle];
+    [newContainer addSubview:newIcon];
+    NSArray *constraints = [layoutTemplate installOnViews:@[newContainer, newTitle, newIcon]];
+    expect([MASViewConstraint installedConstraintsForView:newIcon]).to.haveCountOf(4);
+
+    [newIcon mas_updateConstraints:^(MASConstraintMaker *make) {
+        make.left.equalTo(@16);
+    }];
+    expect([constraints[0] constant]).to.equal(16);
+    expect(newContainer.constraints).to.haveCountOf(5);
+
+    [newIcon mas_remakeConstraints:^(MASConstraintMaker *make) {
+        make.left.equalTo(@8);
+    }];
+    expect([MASViewConstraint installedConstraintsForView:newIcon]).to.haveCountOf(1);
+    expect(newContainer.constraints).to.haveCountOf(4);
+    expect(newIcon.constraints).to.haveCountOf(0);
+}
+
+- (void)testResolvesImplicitSuperview {
+    MAS_VIEW *view = MAS_VIEW.new;
+    [container addSubview:view];
+    MASLayoutTemplate *superviewTemplate = [MASLayoutTemplate templateWithViews:@[view] recording:^{
+        [view mas_makeConstraints:^(MASConstraintMaker *make) {
+            make.top.equalTo(@10);
+        }];
+    }];
+    expect(superviewTemplate.entries[0].secondSlot).to.equal(MASLayoutTemplateSlotSuperview);
+
+    MAS_VIEW *newSuperview = MAS_VIEW.new;
+    MAS_VIEW *newView = MAS_VIEW.new;
+    [newSuperview addSubview:newView];
+    NSArray *constraints = [superviewTemplate installOnViews:@[newView]];
+
+    expect([constraints[0] secondItem]).to.beIdenticalTo(newSuperview);
+    expect(newSuperview.constraints).to.haveCountOf(1);
+}
+
+SpecEnd
@@ -0,0 +1,129 @@
+//
+//  MASLayoutTransactionSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASLayoutTransaction.h"
+#import "MASViewConstraint.h"
+#import "MASViewConstraint+Private.h"
+#import "View+MASAdditions.h"
+
+SpecBegin(MASLayoutTransaction) {
+    MAS_VIEW *superview;
+    MAS_VIEW *view;
+    MASViewConstraint *width;
+}
+
+- (void)setUp {
+    superview = MAS_VIEW.new;
+    view = MAS_VIEW.new;
+    [superview addSubview:view];
+    __block MASViewConstraint *madeWidth;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        madeWidth = (id)make.width.equalTo(@10);
+    }];
+    width = madeWidth;
+}
+
+- (void)tearDown {
+    MASLayoutTransaction.coalescingEnabled = NO;
+    [MASLayoutTransaction flush];
+}
+
+- (void)testCollapsesUpdatesUntilFlush {
+    NSLayoutConstraint *layoutConstraint = width.layoutConstraint;
+    NSUInteger coalescedCount = MASLayoutTransaction.coalescedCount;
+
+    [MASLayoutTransaction performTransaction:^{
+        expect(MASLayoutTransaction.isBuffering).to.beTruthy();
+        for (NSUInteger i = 1; i <= 3; i++) {
+            [view mas_updateConstraints:^(MASConstraintMaker *make) {
+                make.width.equalTo(@(10 * i + 10));
+            }];
+        }
+    }];
+    expect(MASLayoutTransaction.isBuffering).to.beFalsy();
+    expect(MASLayoutTransaction.pendingCount).to.equal(1);
+    expect(MASLayoutTransaction.coalescedCount - coalescedCount).to.equal(2);
+    expect(layoutConstraint.constant).to.equal(10);
+
+    [MASLayoutTransaction flush];
+    expect(MASLayoutTransaction.pendingCount).to.equal(0);
+    expect(layoutConstraint.constant).to.equal(40);
+    expect([MASViewConstraint installedConstraintsForView:view]).to.haveCountOf(1);
+}
+
+- (void)testReplacedHandlesShareTheFlushedConstraint {
+    __block MASViewConstraint *first;
+    __block MASViewConstraint *last;
+    [MASLayoutTransaction performTransaction:^{
+        [view mas_updateConstraints:^(MASConstraintMaker *make) {
+            first = (id)make.width.equalTo(@20);
+        }];
+        [view mas_updateConstraints:^(MASConstraintMaker *make) {
+            last = (id)make.width.equalTo(@30);
+        }];
+    }];
+    expect(first.layoutConstraint).to.beNil();
+
+    [MASLayoutTransaction flush];
+    expect(last.layoutConstraint).to.beIdenticalTo(width.layoutConstraint);
+    expect(first.layoutConstraint).to.beIdenticalTo(width.layoutConstraint);
+    expect(width.layoutConstraint.constant).to.equal(30);
+
+    first.offset(40);
+    expect(width.layoutConstraint.constant).to.equal(40);
+}
+
+- (void)testNestedTransactions {
+    [MASLayoutTransaction performTransaction:^{
+        [MASLayoutTransaction performTransaction:^{
+            [view mas_updateConstraints:^(MASConstraintMaker *make) {
+                make.width.equalTo(@20);
+            }];
+        }];
+        expect(MASLayoutTransaction.isBuffering).to.beTruthy();
+        [view mas_updateConstraints:^(MASConstraintMaker *make) {
+            make.width.equalTo(@30);
+            make.height.equalTo(@5);
+        }];
+    }];
+    expect(MASLayoutTransaction.pendingCount).to.equal(2);
+    expect(width.layoutConstraint.constant).to.equal(10);
+
+    [MASLayoutTransaction flush];
+    expect(width.layoutConstraint.constant).to.equal(30);
+    expect([MASViewConstraint installedConstraintsForView:view]).to.haveCountOf(2);
+}
+
+- (void)testRemakeFlushesBufferedUpdatesFirst {
+    MASLayoutTransaction.coalescingEnabled = YES;
+    [view mas_updateConstraints:^(MASConstraintMaker *make) {
+        make.height.equalTo(@20);
+    }];
+    expect(MASLayoutTransaction.pendingCount).to.equal(1);
+
+    [view mas_remakeConstraints:^(MASConstraintMaker *make) {
+        make.width.equalTo(@10);
+    }];
+    // the buffered height was installed before the remake replaced it
+    expect(MASLayoutTransaction.pendingCount).to.equal(0);
+    expect([MASViewConstraint installedConstraintsForView:view]).to.haveCountOf(1);
+}
+
+- (void)testFlushesBeforeTheRunLoopWaits {
+    MASLayoutTransaction.coalescingEnabled = YES;
+    [view mas_updateConstraints:^(MASConstraintMaker *make) {
+        make.width.equalTo(@50);
+    }];
+    expect(width.layoutConstraint.constant).to.equal(10);
+
+    [NSRunLoop.mainRunLoop runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    expect(MASLayoutTransaction.pendingCount).to.equal(0);
+    expect(width.layoutConstraint.constant).to.equal(50);
+}
+
+SpecEnd
@@ -0,0 +1,100 @@
+//
+//  MASSizeCacheSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASSizeCache.h"
+#import "View+MASAdditions.h"
+
+SpecBegin(MASSizeCache) {
+    MASSizeCache *cache;
+    MAS_VIEW *contentView;
+    MAS_VIEW *titleView;
+}
+
+- (void)setUp {
+    cache = [[MASSizeCache alloc] initWithCountLimit:2];
+    contentView = MAS_VIEW.new;
+    titleView = MAS_VIEW.new;
+    [contentView addSubview:titleView];
+    [titleView mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.edges.equalTo(contentView).insets(MASEdgeInsetsMake(8, 8, 8, 8));
+    }];
+    [cache registerView:contentView forLayoutIdentifier:@"cell"];
+}
+
+- (void)testKeys {
+    [cache setSize:CGSizeMake(320, 44) forLayoutIdentifier:@"cell" contentHash:1 width:320];
+
+    CGSize size = CGSizeZero;
+    expect([cache getSize:&size forLayoutIdentifier:@"cell" contentHash:1 width:320]).to.beTruthy();
+    expect(size.height).to.equal(44);
+    expect([cache getSize:&size forLayoutIdentifier:@"cell" contentHash:2 width:320]).to.beFalsy();
+    expect([cache getSize:&size forLayoutIdentifier:@"cell" contentHash:1 width:480]).to.beFalsy();
+    expect([cache getSize:&size forLayoutIdentifier:@"header" contentHash:1 width:320]).to.beFalsy();
+
+    __block NSUInteger computeCount = 0;
+    CGSize (^compute)(void) = ^{
+        computeCount++;
+        return CGSizeMake(480, 60);
+    };
+    expect([cache sizeForLayoutIdentifier:@"cell" contentHash:1 width:480 computeIfNeeded:compute].height).to.equal(60);
+    expect([cache sizeForLayoutIdentifier:@"cell" contentHash:1 width:480 computeIfNeeded:compute].height).to.equal(60);
+    expect(computeCount).to.equal(1);
+}
+
+- (void)testEvictsLeastRecentlyUsed {
+    [cache setSize:CGSizeMake(320, 1) forLayoutIdentifier:@"cell" contentHash:1 width:320];
+    [cache setSize:CGSizeMake(320, 2) forLayoutIdentifier:@"cell" contentHash:2 width:320];
+    expect([cache getSize:NULL forLayoutIdentifier:@"cell" contentHash:1 width:320]).to.beTruthy();
+
+    [cache setSize:CGSizeMake(320, 3) forLayoutIdentifier:@"cell" contentHash:3 width:320];
+    expect(cache.count).to.equal(2);
+    expect([cache getSize:NULL forLayoutIdentifier:@"cell" contentHash:1 width:320]).to.beTruthy();
+    expect([cache getSize:NULL forLayoutIdentifier:@"cell" contentHash:2 width:320]).to.beFalsy();
+    expect([cache getSize:NULL forLayoutIdentifier:@"cell" contentHash:3 width:320]).to.beTruthy();
+
+    [cache removeAllSizes];
+    expect(cache.count).to.equal(0);
+}
+
+- (void)testInvalidatesWhenConstraintsChange {
+    [cache setSize:CGSizeMake(320, 44) forLayoutIdentifier:@"cell" contentHash:1 width:320];
+
+    // registering another cell, remaking identical constraints or changing constants keeps the sizes
+    MAS_VIEW *otherContentView = MAS_VIEW.new;
+    [cache registerView:otherContentView forLayoutIdentifier:@"cell"];
+    [titleView mas_remakeConstraints:^(MASConstraintMaker *make) {
+        make.edges.equalTo(contentView).insets(MASEdgeInsetsMake(8, 8, 8, 8));
+    }];
+    [titleView mas_updateConstraints:^(MASConstraintMaker *make) {
+        make.top.equalTo(contentView).offset(16);
+    }];
+    expect([cache getSize:NULL forLayoutIdentifier:@"cell" contentHash:1 width:320]).to.beTruthy();
+
+    [titleView mas_updateConstraints:^(MASConstraintMaker *make) {
+        make.height.equalTo(@20);
+    }];
+    expect([cache getSize:NULL forLayoutIdentifier:@"cell" contentHash:1 width:320]).to.beFalsy();
+
+    [cache setSize:CGSizeMake(320, 52) forLayoutIdentifier:@"cell" contentHash:1 width:320];
+    [titleView mas_remakeConstraints:^(MASConstraintMaker *make) {
+        make.left.top.right.equalTo(contentView);
+    }];
+    expect([cache getSize:NULL forLayoutIdentifier:@"cell" contentHash:1 width:320]).to.beFalsy();
+
+    [cache setSize:CGSizeMake(320, 36) forLayoutIdentifier:@"cell" contentHash:1 width:320];
+    [cache invalidateLayoutIdentifier:@"cell"];
+    expect([cache getSize:NULL forLayoutIdentifier:@"cell" contentHash:1 width:320]).to.beFalsy();
+}
+
+- (void)testPurgesOnMemoryWarning {
+    [cache setSize:CGSizeMake(320, 44) forLayoutIdentifier:@"cell" contentHash:1 width:320];
+    [[NSNotificationCenter defaultCenter] postNotificationName:UIApplicationDidReceiveMemoryWarningNotification object:nil];
+    expect(cache.count).to.equal(0);
+}
+
+SpecEnd
@@ -0,0 +1,244 @@
+//
+//  MASStackSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASStack.h"
+#import "MASChurn.h"
+#import "View+MASAdditions.h"
+
+SpecBegin(MASStack) {
+    MAS_VIEW *superview;
+    MAS_VIEW *containerView;
+    MASStack *stack;
+}
+
+- (void)setUp {
+    superview = [[MAS_VIEW alloc] initWithFrame:CGRectMake(0, 0, 320, 10000)];
+    containerView = MAS_VIEW.new;
+    [superview addSubview:containerView];
+    [containerView mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.left.top.right.equalTo(superview);
+    }];
+
+    stack = [[MASStack alloc] initWithContainerView:containerView axisType:MASAxisTypeVertical];
+    stack.spacing = 5;
+    stack.leadSpacing = 1;
+    stack.tailSpacing = 2;
+}
+
+- (MAS_VIEW *)viewWithHeight:(CGFloat)height {
+    MAS_VIEW *view = MAS_VIEW.new;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.height.equalTo(@(height));
+    }];
+    return view;
+}
+
+- (CGRect)frameOfView:(MAS_VIEW *)view {
+    [superview layoutIfNeeded];
+    return view.frame;
+}
+
+- (void)testChainsViews {
+    MAS_VIEW *view1 = [self viewWithHeight:10];
+    MAS_VIEW *view2 = [self viewWithHeight:20];
+    MAS_VIEW *view3 = [self viewWithHeight:30];
+    [stack addArrangedView:view1];
+    [stack addArrangedView:view3];
+    [stack insertArrangedView:view2 beforeView:view3];
+
+    expect(stack.arrangedViews).to.equal((@[view1, view2, view3]));
+    expect(view2.superview).to.beIdenticalTo(containerView);
+    expect([self frameOfView:view1]).to.equal(CGRectMake(0, 1, 320, 10));
+    expect([self frameOfView:view2]).to.equal(CGRectMake(0, 16, 320, 20));
+    expect([self frameOfView:view3]).to.equal(CGRectMake(0, 41, 320, 30));
+    expect([self frameOfView:containerView].size.height).to.equal(73);
+
+    stack.spacing = 0;
+    stack.tailSpacing = 0;
+    expect([self frameOfView:view3].origin.y).to.equal(31);
+    expect([self frameOfView:containerView].size.height).to.equal(61);
+}
+
+- (void)testHidingCollapsesView {
+    MAS_VIEW *view1 = [self viewWithHeight:10];
+    MAS_VIEW *view2 = [self viewWithHeight:20];
+    MAS_VIEW *view3 = [self viewWithHeight:30];
+    [stack addArrangedView:view1];
+    [stack addArrangedView:view2];
+    [stack addArrangedView:view3];
+
+    [stack setArrangedView:view2 hidden:YES];
+    expect(view2.hidden).to.beTruthy();
+    expect([self frameOfView:view3].origin.y).to.equal(16);
+
+    [stack setArrangedView:view3 hidden:YES];
+    expect([self frameOfView:containerView].size.height).to.equal(13);
+
+    [stack setArrangedView:view2 hidden:NO];
+    expect([self frameOfView:view2].origin.y).to.equal(16);
+    expect([self frameOfView:containerView].size.height).to.equal(38);
+}
+
+- (void)testRemovesAndMovesViews {
+    MAS_VIEW *view1 = [self viewWithHeight:10];
+    MAS_VIEW *view2 = [self viewWithHeight:20];
+    MAS_VIEW *view3 = [self viewWithHeight:30];
+    [stack performBatchUpdates:^{
+        [stack addArrangedView:view1];
+        [stack addArrangedView:view2];
+        [stack addArrangedView:view3];
+    }];
+
+    [stack moveArrangedView:view1 afterView:view3];
+    expect(stack.arrangedViews).to.equal((@[view2, view3, view1]));
+    expect([self frameOfView:view2].origin.y).to.equal(1);
+    expect([self frameOfView:view1].origin.y).to.equal(61);
+
+    [stack removeArrangedView:view3];
+    expect(stack.count).to.equal(2);
+    expect(view3.superview).to.beNil();
+    expect([MASViewConstraint installedConstraintsForView:view3]).to.haveCountOf(1);
+    expect([self frameOfView:view1].origin.y).to.equal(26);
+    expect([self frameOfView:containerView].size.height).to.equal(38);
+}
+
+- (void)testInsertsAndMovesInTheMiddle {
+    MAS_VIEW *view1 = [self viewWithHeight:10];
+    MAS_VIEW *view2 = [self viewWithHeight:20];
+    MAS_VIEW *view3 = [self viewWithHeight:30];
+    MAS_VIEW *view4 = [self viewWithHeight:40];
+    [stack addArrangedView:view1];
+    [stack addArrangedView:view2];
+    [stack addArrangedView:view3];
+
+    [stack insertArrangedView:view4 afterView:view1];
+    expect(stack.arrangedViews).to.equal((@[view1, view4, view2, view3]));
+    expect([self frameOfView:view4].origin.y).to.equal(16);
+    expect([self frameOfView:view2].origin.y).to.equal(61);
+    expect([self frameOfView:view3].origin.y).to.equal(86);
+
+    [stack moveArrangedView:view3 afterView:view1];
+    expect(stack.arrangedViews).to.equal((@[view1, view3, view4, view2]));
+    expect([self frameOfView:view3].origin.y).to.equal(16);
+    expect([self frameOfView:view4].origin.y).to.equal(51);
+    expect([self frameOfView:view2].origin.y).to.equal(96);
+    expect([self frameOfView:containerView].size.height).to.equal(118);
+
+    // a shown view takes its place back from the view after it
+    [stack setArrangedView:view4 hidden:YES];
+    [stack setArrangedView:view4 hidden:NO];
+    expect([self frameOfView:view4].origin.y).to.equal(51);
+    expect([self frameOfView:view2].origin.y).to.equal(96);
+}
+
+- (void)testMutationsOnlyRewireNeighbours {
+    NSMutableArray *views = [NSMutableArray array];
+    for (int i = 0; i < 200; i++) {
+        MAS_VIEW *view = [self viewWithHeight:10];
+        [stack addArrangedView:view];
+        [views addObject:view];
+    }
+
+    MASChurnCounts before = MASChurn.globalCounts;
+    MAS_VIEW *view = [self viewWithHeight:10];
+    [stack insertArrangedView:view atIndex:100];
+    MASChurnCounts after = MASChurn.globalCounts;
+
+    expect(stack.arrangedViews[100]).to.beIdenticalTo(view);
+    // the cross axis edges and lead of the new view, and the new lead of the view after it
+    expect(after.counts[MASChurnEventCreated] - before.counts[MASChurnEventCreated]).to.equal(4);
+    expect(after.counts[MASChurnEventUninstalled] - before.counts[MASChurnEventUninstalled]).to.equal(1);
+
+    before = MASChurn.globalCounts;
+    [stack removeArrangedView:views[50]];
+    after = MASChurn.globalCounts;
+    expect(after.counts[MASChurnEventCreated] - before.counts[MASChurnEventCreated]).to.equal(1);
+    expect(after.counts[MASChurnEventUninstalled] - before.counts[MASChurnEventUninstalled]).to.equal(4);
+
+    expect([self frameOfView:views.lastObject].origin.y).to.equal(1 + 199 * 15);
+}
+
+- (void)testWindowingKeepsViewsNearVisibleRect {
+    NSMutableArray *views = [NSMutableArray array];
+    [stack performBatchUpdates:^{
+        for (int i = 0; i < 1000; i++) {
+            MAS_VIEW *view = [self viewWithHeight:10];
+            [stack addArrangedView:view];
+            [views addObject:view];
+        }
+    }];
+    CGFloat contentHeight = 1 + 1000 * 10 + 999 * 5 + 2;
+    expect([self frameOfView:containerView].size.height).to.equal(contentHeight);
+
+    stack.windowingEnabled = YES;
+    [stack updateWindowWithVisibleRect:CGRectMake(0, 3000, 320, 500)];
+    // views 200 to 233 overlap the window
+    expect(stack.windowedViews).to.haveCountOf(34);
+    expect(stack.windowedViews.firstObject).to.beIdenticalTo(views[200]);
+    expect([views[0] superview]).to.beNil();
+    expect(containerView.constraints.count).to.beLessThan(200);
+    expect([self frameOfView:views[200]].origin.y).to.equal(3001);
+    expect([self frameOfView:containerView].size.height).to.equal(contentHeight);
+
+    stack.prefetchLength = 100;
+    [stack updateWindowWithVisibleRect:CGRectMake(0, 6000, 320, 500)];
+    expect([views[200] superview]).to.beNil();
+    expect(stack.windowedViews.firstObject).to.beIdenticalTo(views[393]);
+    expect([self frameOfView:views[400]].origin.y).to.equal(6001);
+    expect([self frameOfView:containerView].size.height).to.equal(contentHeight);
+
+    // views appended beyond the window stay detached but count towards the content length
+    MAS_VIEW *view = [self viewWithHeight:10];
+    [stack addArrangedView:view];
+    expect(view.superview).to.beNil();
+    expect([self frameOfView:containerView].size.height).to.equal(contentHeight + 5 + stack.estimatedLength);
+
+    stack.windowingEnabled = NO;
+    expect(stack.windowedViews).to.haveCountOf(1001);
+    expect([self frameOfView:views[0]].origin.y).to.equal(1);
+    expect([self frameOfView:containerView].size.height).to.equal(contentHeight + 15);
+}
+
+- (void)testWindowFollowsScrollingBothWays {
+    NSMutableArray *views = [NSMutableArray array];
+    [stack performBatchUpdates:^{
+        for (int i = 0; i < 1000; i++) {
+            MAS_VIEW *view = [self viewWithHeight:10];
+            [stack addArrangedView:view];
+            [views addObject:view];
+        }
+    }];
+    CGFloat contentHeight = 1 + 1000 * 10 + 999 * 5 + 2;
+
+    stack.windowingEnabled = YES;
+    [stack updateWindowWithVisibleRect:CGRectMake(0, 6000, 320, 500)];
+    [stack updateWindowWithVisibleRect:CGRectMake(0, 3000, 320, 500)];
+    expect(stack.windowedViews.firstObject).to.beIdenticalTo(views[200]);
+    expect(stack.windowedViews.lastObject).to.beIdenticalTo(views[233]);
+    expect([views[400] superview]).to.beNil();
+    expect([self frameOfView:views[200]].origin.y).to.equal(3001);
+    expect([self frameOfView:containerView].size.height).to.equal(contentHeight);
+
+    // views inserted, hidden or removed before the window move it along
+    MAS_VIEW *view = [self viewWithHeight:10];
+    [stack insertArrangedView:view atIndex:0];
+    expect(view.superview).to.beNil();
+    [stack setArrangedView:views[0] hidden:YES];
+    [stack removeArrangedView:views[1]];
+    CGFloat shift = 5 + stack.estimatedLength - 15 - 15;
+    expect([self frameOfView:views[200]].origin.y).to.equal(3001 + shift);
+    expect([self frameOfView:containerView].size.height).to.equal(contentHeight + shift);
+
+    [stack updateWindowWithVisibleRect:CGRectMake(0, 0, 320, 100)];
+    expect(stack.windowedViews).to.equal((@[view, views[0], views[2], views[3], views[4], views[5]]));
+    expect([views[200] superview]).to.beNil();
+    expect([self frameOfView:views[2]].origin.y).to.equal(16);
+    expect([self frameOfView:containerView].size.height).to.equal(contentHeight - 15);
+}
+
+SpecEnd
@@ -0,0 +1,100 @@
+//
+//  MASTraceSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASTrace.h"
+#import "View+MASAdditions.h"
+#import "MASViewConstraint.h"
+
+SpecBegin(MASTrace) {
+    MAS_VIEW *superview;
+    MAS_VIEW *view;
+}
+
+- (void)setUp {
+    superview = MAS_VIEW.new;
+    view = MAS_VIEW.new;
+    view.mas_key = @"view";
+    [superview addSubview:view];
+    [MASTrace reset];
+    MASTrace.enabled = YES;
+}
+
+- (void)tearDown {
+    MASTrace.enabled = NO;
+    [MASTrace reset];
+}
+
+- (NSArray *)traceEventsNamed:(NSString *)name {
+    NSDictionary *trace = [NSJSONSerialization JSONObjectWithData:MASTrace.chromeTraceData options:0 error:NULL];
+    return [trace[@"traceEvents"] filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"name == %@", name]];
+}
+
+- (void)testRecordsSpans {
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.edges.equalTo(superview);
+    }];
+    [view mas_updateConstraints:^(MASConstraintMaker *make) {
+        make.left.equalTo(superview).offset(10);
+    }];
+
+    NSArray *makeEvents = [self traceEventsNamed:@"mas_makeConstraints"];
+    expect(makeEvents).to.haveCountOf(1);
+    expect(makeEvents[0][@"ph"]).to.equal(@"X");
+    expect(makeEvents[0][@"args"][@"key"]).to.equal(@"view");
+    expect(makeEvents[0][@"args"][@"constraints"]).to.equal(1);
+    expect(makeEvents[0][@"args"][@"mode"]).to.equal(@"make");
+
+    expect([self traceEventsNamed:@"MASViewConstraint install"]).to.haveCountOf(5);
+    expect([self traceEventsNamed:@"mas_updateConstraints"][0][@"args"][@"mode"]).to.equal(@"update");
+    expect([self traceEventsNamed:@"layoutConstraintSimilarTo"]).to.haveCountOf(1);
+
+    // spans nest within the entry point on the same thread
+    NSDictionary *installEvent = [self traceEventsNamed:@"MASConstraintMaker install"].firstObject;
+    expect(installEvent[@"tid"]).to.equal(makeEvents[0][@"tid"]);
+    expect([installEvent[@"ts"] doubleValue]).to.beGreaterThanOrEqualTo([makeEvents[0][@"ts"] doubleValue]);
+}
+
+- (void)testDisabledAndReset {
+    MASTrace.enabled = NO;
+    [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.width.equalTo(@10);
+    }];
+    expect([self traceEventsNamed:@"mas_makeConstraints"]).to.haveCountOf(0);
+
+    MASTrace.enabled = YES;
+    [view mas_remakeConstraints:^(MASConstraintMaker *make) {
+        make.width.equalTo(@20);
+    }];
+    expect([self traceEventsNamed:@"mas_remakeConstraints"]).to.haveCountOf(1);
+
+    [MASTrace reset];
+    expect([self traceEventsNamed:@"mas_remakeConstraints"]).to.haveCountOf(0);
+}
+
+- (void)testRingBufferKeepsMostRecentSpans {
+    NSUInteger capacity = MASTrace.bufferCapacity;
+    MASTrace.bufferCapacity = 8;
+
+    // a fresh thread gets a buffer of the new capacity
+    NSThread *thread = [[NSThread alloc] initWithTarget:self selector:@selector(uninstallConstraintsRepeatedly) object:nil];
+    [thread start];
+    expect(thread.isFinished).will.beTruthy();
+    MASTrace.bufferCapacity = capacity;
+
+    expect([self traceEventsNamed:@"MASViewConstraint uninstall"]).to.haveCountOf(8);
+}
+
+- (void)uninstallConstraintsRepeatedly {
+    // constraints that were never installed don't touch UIKit
+    MASViewConstraint *constraint = [[MASViewConstraint alloc] initWithFirstViewAttribute:nil];
+    for (int i = 0; i < 20; i++) {
+        [constraint uninstall];
+    }
+}
+
+SpecEnd
@@ -7,6 +7,7 @@
 //
 
 #import "MASViewAttribute.h"
+#import "View+MASAdditions.h"
 
 SpecBegin(MASViewAttributeSpec){
     MAS_VIEW *view;
@@ -60,4 +61,20 @@ SpecBegin(MASViewAttributeSpec){
     expect([viewAttribute hash]).toNot.equal([otherViewAttribute hash]);
 }
 
+- (void)testInterning {
+    //should return the same instance for the same view and layoutAttribute
+    expect(view.mas_left).to.beIdenticalTo(view.mas_left);
+    expect([MASViewAttribute attributeWithView:view layoutAttribute:NSLayoutAttributeLeft]).to.beIdenticalTo(view.mas_left);
+
+    //should return distinct instances for a different layoutAttribute or view
+    expect(view.mas_right).notTo.beIdenticalTo(view.mas_left);
+    MAS_VIEW *otherView = [MAS_VIEW new];
+    expect(otherView.mas_left).notTo.beIdenticalTo(view.mas_left);
+    expect(otherView.mas_left).to.equal(otherView.mas_left);
+
+    //should not return interned instances from the initializer
+    expect(viewAttribute).notTo.beIdenticalTo(view.mas_left);
+    expect(viewAttribute).to.equal(view.mas_left);
+}
+
 SpecEnd
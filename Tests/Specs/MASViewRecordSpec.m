@@ -0,0 +1,72 @@
+//
+//  MASViewRecordSpec.m
+//  Masonry
+//
+//  Created by agent on 17/10/26.
+//  Copyright (c) 2026 agent. All rights reserved.
+//
+
+#import "MASViewRecord.h"
+#import "MASViewConstraint.h"
+#import "View+MASAdditions.h"
+
+SpecBegin(MASViewRecord) {
+    MAS_VIEW *superview;
+    MAS_VIEW *view;
+}
+
+- (void)setUp {
+    superview = MAS_VIEW.new;
+    view = MAS_VIEW.new;
+    [superview addSubview:view];
+}
+
+- (void)testNoRecordUntilNeeded {
+    expect([MASViewRecord existingRecordForItem:view]).to.beNil();
+    expect([MASViewConstraint installedConstraintsForView:view]).to.haveCountOf(0);
+    expect([MASViewRecord existingRecordForItem:view]).to.beNil();
+
+    view.mas_key = nil;
+    expect([MASViewRecord existingRecordForItem:view]).to.beNil();
+
+    view.mas_key = @"view";
+    expect([MASViewRecord existingRecordForItem:view].key).to.equal(@"view");
+    expect([MASViewRecord recordForItem:view]).to.beIdenticalTo([MASViewRecord existingRecordForItem:view]);
+}
+
+- (void)testInstalledConstraintsAreOrdered {
+    NSArray *constraints = [view mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.top.equalTo(@1);
+        make.left.equalTo(@2);
+        make.width.equalTo(@3);
+    }];
+
+    MASViewRecord *record = [MASViewRecord existingRecordForItem:view];
+    expect(record.installedConstraintCount).to.equal(3);
+    expect(record.installedConstraints).to.equal(constraints);
+
+    [constraints[1] uninstall];
+    expect(record.installedConstraints).to.equal((@[constraints[0], constraints[2]]));
+
+    [view mas_remakeConstraints:^(MASConstraintMaker *make) {
+        make.height.equalTo(@4);
+    }];
+    expect(record.installedConstraintCount).to.equal(1);
+}
+
+- (void)testPrunesIndexEntriesOfRemovedSubviews {
+    for (NSUInteger i = 0; i < 64; i++) {
+        @autoreleasepool {
+            MAS_VIEW *subview = MAS_VIEW.new;
+            [superview addSubview:subview];
+            [subview mas_makeConstraints:^(MASConstraintMaker *make) {
+                make.left.equalTo(superview).offset(i);
+            }];
+            // removed without uninstalling, the constraint goes away with the subview
+            [subview removeFromSuperview];
+        }
+    }
+    expect([MASViewRecord existingRecordForItem:superview].existingLayoutConstraintIndex.count).to.beLessThanOrEqualTo(16);
+}
+
+SpecEnd
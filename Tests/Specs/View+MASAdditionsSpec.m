@@ -37,4 +37,93 @@ SpecBegin(View_MASAdditions)
     expect(newView.translatesAutoresizingMaskIntoConstraints).to.beFalsy();
 }
 
+- (void)testClosestCommonSuperviewAtDifferentDepths {
+    MAS_VIEW *root = MAS_VIEW.new;
+    MAS_VIEW *branch = MAS_VIEW.new;
+    MAS_VIEW *leaf = MAS_VIEW.new;
+    MAS_VIEW *sibling = MAS_VIEW.new;
+    [root addSubview:branch];
+    [branch addSubview:leaf];
+    [root addSubview:sibling];
+
+    expect([leaf mas_closestCommonSuperview:sibling]).to.beIdenticalTo(root);
+    expect([sibling mas_closestCommonSuperview:leaf]).to.beIdenticalTo(root);
+    expect([leaf mas_closestCommonSuperview:branch]).to.beIdenticalTo(branch);
+    expect([leaf mas_closestCommonSuperview:leaf]).to.beIdenticalTo(leaf);
+    expect([leaf mas_closestCommonSuperview:MAS_VIEW.new]).to.beNil();
+}
+
+- (void)testClosestCommonSuperviewCache {
+    MAS_VIEW *root = MAS_VIEW.new;
+    MAS_VIEW *first = MAS_VIEW.new;
+    MAS_VIEW *second = MAS_VIEW.new;
+    [root addSubview:first];
+    [root addSubview:second];
+
+    MAS_VIEW *otherRoot = MAS_VIEW.new;
+    MAS_VIEW *stranger = MAS_VIEW.new;
+
+    [MAS_VIEW mas_performWithCommonSuperviewCache:^{
+        expect([first mas_closestCommonSuperview:second]).to.beIdenticalTo(root);
+        expect([first mas_closestCommonSuperview:stranger]).to.beNil();
+
+        // the hierarchy changes are not seen while the cache is live, both answers are memoized
+        [otherRoot addSubview:second];
+        [root addSubview:stranger];
+        expect([second mas_closestCommonSuperview:first]).to.beIdenticalTo(root);
+        expect([stranger mas_closestCommonSuperview:first]).to.beNil();
+    }];
+
+    expect([first mas_closestCommonSuperview:second]).to.beNil();
+    expect([first mas_closestCommonSuperview:stranger]).to.beIdenticalTo(root);
+}
+
+- (void)testSetConstantsOfKeyedConstraints {
+    MAS_VIEW *superview = MAS_VIEW.new;
+    MAS_VIEW *newView = MAS_VIEW.new;
+    [superview addSubview:newView];
+
+    __block MASConstraint *width = nil;
+    [newView mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.edges.equalTo(superview).key(@"edges");
+        width = make.width.equalTo(@100).key(@"width");
+    }];
+    expect([newView mas_constraintForKey:@"width"]).to.beIdenticalTo(width);
+    expect([newView mas_constraintForKey:@"edges"]).to.beNil();
+
+    expect([newView mas_setConstant:20 forKey:@"width"]).to.beTruthy();
+    expect([newView.constraints.firstObject constant]).to.equal(20);
+
+    NSUInteger count = [newView mas_setConstants:@{ @"edges[0]": @5, @"edges[2]": @7, @"missing": @1 }];
+    expect(count).to.equal(2);
+    for (NSLayoutConstraint *constraint in superview.constraints) {
+        if (constraint.firstAttribute == NSLayoutAttributeLeft) expect(constraint.constant).to.equal(5);
+        if (constraint.firstAttribute == NSLayoutAttributeTop) expect(constraint.constant).to.equal(7);
+        if (constraint.firstAttribute == NSLayoutAttributeRight) expect(constraint.constant).to.equal(0);
+    }
+
+    [width uninstall];
+    expect([newView mas_constraintForKey:@"width"]).to.beNil();
+    expect([newView mas_setConstant:30 forKey:@"width"]).to.beFalsy();
+}
+
+- (void)testKeyedConstraintsFollowRemake {
+    MAS_VIEW *superview = MAS_VIEW.new;
+    MAS_VIEW *newView = MAS_VIEW.new;
+    [superview addSubview:newView];
+
+    [newView mas_makeConstraints:^(MASConstraintMaker *make) {
+        make.left.equalTo(superview).key(@"left");
+    }];
+    __block MASConstraint *left = nil;
+    [newView mas_remakeConstraints:^(MASConstraintMaker *make) {
+        left = make.left.equalTo(superview).offset(10).key(@"left");
+    }];
+    expect([newView mas_constraintForKey:@"left"]).to.beIdenticalTo(left);
+
+    [newView mas_setConstant:15 forKey:@"left"];
+    expect(superview.constraints).to.haveCountOf(1);
+    expect([superview.constraints.firstObject constant]).to.equal(15);
+}
+
 SpecEnd
\ No newline at end of file
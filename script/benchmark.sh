@@ -0,0 +1,15 @@
+#!/bin/bash
+# Runs the benchmark specs on the simulator without opening Xcode, eg on CI.
+# Results are printed and appended as JSON lines to the file given as first argument, default benchmark.jsonl
+
+set -o pipefail
+output="${1:-benchmark.jsonl}"
+case "$output" in
+	/*) ;;
+	*) output="$PWD/$output" ;;
+esac
+
+TEST_RUNNER_MAS_BENCHMARK=1 TEST_RUNNER_MAS_BENCHMARK_OUTPUT="$output" \
+xcodebuild -workspace 'Masonry.xcworkspace' -scheme 'Masonry iOS Tests' -configuration Release \
+	-sdk iphonesimulator -destination "${DESTINATION:-platform=iOS Simulator,name=iPhone 8}" \
+	-only-testing:'Masonry iOS Tests/MASBenchmarkSpec' test
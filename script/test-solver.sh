@@ -0,0 +1,13 @@
+#!/bin/bash
+# Builds the headless layout solver with the plain C tests and runs them, no Xcode needed, eg on Linux CI.
+# The compiler defaults to cc, override it with CC.
+
+set -e
+cd "$(dirname "$0")/.."
+build="${BUILD_DIR:-${TMPDIR:-/tmp}/masonry-solver}"
+mkdir -p "$build"
+
+${CC:-cc} -std=c99 -Wall -Wextra -pedantic -Werror -O2 -IMasonry \
+	Masonry/MASLayoutSolver.c Masonry/MASLayoutTree.c Tests/Solver/MASLayoutSolverTests.c \
+	-lm -o "$build/MASLayoutSolverTests"
+"$build/MASLayoutSolverTests"